@@ -0,0 +1,138 @@
+#ifndef MY_VECTOR_ASYNC_GENERATOR_HPP
+#define MY_VECTOR_ASYNC_GENERATOR_HPP
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Coroutine that produces a sequence of T and may suspend on other
+// awaitables (channels, executors) between values.
+//
+// The body starts lazily: every co_await next() resumes it until it yields
+// the next value or returns. The value stays in the generator's frame and the
+// consumer gets a pointer to it that is valid until the next call to next();
+// the consumer may move from it. Control passes between consumer and
+// generator by symmetric transfer, so a chain of generators runs on one
+// thread without growing the stack. When a generator suspends on something
+// else, whichever thread resumes it carries the chain on. An exception that
+// leaves the body is rethrown from next().
+template <typename T>
+class async_generator {
+    static_assert(!std::is_reference_v<T>, "async_generator yields objects, not references");
+
+public:
+    using value_type = T;
+
+    class promise_type {
+        friend class async_generator;
+
+        T* value_ = nullptr;
+        std::coroutine_handle<> consumer_;
+        std::exception_ptr error_;
+
+        // Suspends the generator and resumes the consumer.
+        struct yield_to_consumer {
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> self) const noexcept {
+                return self.promise().consumer_;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+    public:
+        async_generator get_return_object() noexcept {
+            return async_generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        yield_to_consumer final_suspend() const noexcept {
+            return {};
+        }
+
+        yield_to_consumer yield_value(T& value) noexcept {
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        yield_to_consumer yield_value(T&& value) noexcept {
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() noexcept {
+            value_ = nullptr;
+        }
+
+        void unhandled_exception() noexcept {
+            value_ = nullptr;
+            error_ = std::current_exception();
+        }
+    };
+
+    class next_awaiter {
+        std::coroutine_handle<promise_type> producer_;
+
+    public:
+        explicit next_awaiter(std::coroutine_handle<promise_type> producer) noexcept : producer_(producer) {}
+
+        bool await_ready() const noexcept {
+            return !producer_ || producer_.done();
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) const noexcept {
+            producer_.promise().consumer_ = consumer;
+            return producer_;
+        }
+
+        // The next value, or nullptr once the generator has returned.
+        T* await_resume() const {
+            if (!producer_) return nullptr;
+            promise_type& promise = producer_.promise();
+            if (promise.error_) {
+                std::rethrow_exception(std::exchange(promise.error_, nullptr));
+            }
+            return producer_.done() ? nullptr : promise.value_;
+        }
+    };
+
+    async_generator() noexcept = default;
+
+    async_generator(async_generator&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    async_generator& operator=(async_generator&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    async_generator(const async_generator&) = delete;
+    async_generator& operator=(const async_generator&) = delete;
+
+    // Must not be destroyed while a next() is in progress.
+    ~async_generator() {
+        if (handle_) handle_.destroy();
+    }
+
+    // co_await next() gives a T* to the next value, or nullptr at the end.
+    [[nodiscard]] next_awaiter next() const noexcept {
+        return next_awaiter(handle_);
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+    explicit async_generator(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+};
+
+#endif //MY_VECTOR_ASYNC_GENERATOR_HPP
@@ -0,0 +1,9 @@
+#ifndef MY_VECTOR_BENCHMARK_D_ARY_HEAP_HPP
+#define MY_VECTOR_BENCHMARK_D_ARY_HEAP_HPP
+
+#include "d_ary_heap.hpp"
+#include "perf_counters.hpp"
+
+void run_all_d_ary_heap_benchmarks();
+
+#endif //MY_VECTOR_BENCHMARK_D_ARY_HEAP_HPP
@@ -0,0 +1,9 @@
+#ifndef MY_VECTOR_BENCHMARK_FLAT_HASH_MAP_HPP
+#define MY_VECTOR_BENCHMARK_FLAT_HASH_MAP_HPP
+
+#include "flat_hash_map.hpp"
+#include "perf_counters.hpp"
+
+void run_all_flat_hash_map_benchmarks();
+
+#endif //MY_VECTOR_BENCHMARK_FLAT_HASH_MAP_HPP
@@ -0,0 +1,15 @@
+#ifndef MY_VECTOR_BENCHMARK_MY_VECTOR_HPP
+#define MY_VECTOR_BENCHMARK_MY_VECTOR_HPP
+
+#include "my_vector.hpp"
+#include "perf_counters.hpp"
+
+void benchmark_push_back();
+void benchmark_push_back_reserved();
+void benchmark_insert_front();
+void benchmark_erase_front();
+void benchmark_reallocate();
+
+void run_all_my_vector_benchmarks();
+
+#endif //MY_VECTOR_BENCHMARK_MY_VECTOR_HPP
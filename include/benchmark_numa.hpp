@@ -0,0 +1,11 @@
+#ifndef MY_VECTOR_BENCHMARK_NUMA_HPP
+#define MY_VECTOR_BENCHMARK_NUMA_HPP
+
+#include "numa_placement.hpp"
+#include "perf_counters.hpp"
+
+void benchmark_numa_bandwidth(numa_policy policy, const char* name);
+
+void run_all_numa_benchmarks();
+
+#endif //MY_VECTOR_BENCHMARK_NUMA_HPP
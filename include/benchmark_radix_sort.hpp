@@ -0,0 +1,9 @@
+#ifndef MY_VECTOR_BENCHMARK_RADIX_SORT_HPP
+#define MY_VECTOR_BENCHMARK_RADIX_SORT_HPP
+
+#include "radix_sort.hpp"
+#include "perf_counters.hpp"
+
+void run_all_radix_sort_benchmarks();
+
+#endif //MY_VECTOR_BENCHMARK_RADIX_SORT_HPP
@@ -0,0 +1,442 @@
+#ifndef MY_VECTOR_BIT_VECTOR_HPP
+#define MY_VECTOR_BIT_VECTOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "my_vector.hpp"
+
+// Dynamic array of bits packed 64 per word into a my_vector<std::uint64_t>.
+//
+// Individual bits are accessed through proxy references. Scans (count,
+// find_first/find_next) and the bitwise kernels work a whole word at a time.
+// Bits of the last word past size() are always kept zero, so the word-level
+// operations never have to mask anything except after flip().
+class bit_vector {
+public:
+    using word_type = std::uint64_t;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using value_type = bool;
+
+    static constexpr size_type bits_per_word = 64;
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    class reference {
+        friend class bit_vector;
+
+        word_type* word_;
+        word_type mask_;
+
+        reference(word_type* word, size_type bit) noexcept : word_(word), mask_(word_type(1) << bit) {}
+
+    public:
+        reference(const reference&) = default;
+
+        operator bool() const noexcept {
+            return (*word_ & mask_) != 0;
+        }
+
+        reference& operator=(bool value) noexcept {
+            if (value) {
+                *word_ |= mask_;
+            } else {
+                *word_ &= ~mask_;
+            }
+            return *this;
+        }
+
+        reference& operator=(const reference& other) noexcept {
+            return *this = static_cast<bool>(other);
+        }
+
+        bool operator~() const noexcept {
+            return !static_cast<bool>(*this);
+        }
+
+        void flip() noexcept {
+            *word_ ^= mask_;
+        }
+    };
+
+    using const_reference = bool;
+
+    class const_iterator {
+        const bit_vector* owner_ = nullptr;
+        size_type pos_ = 0;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = bool;
+
+        const_iterator() = default;
+
+        const_iterator(const bit_vector* owner, size_type pos) noexcept : owner_(owner), pos_(pos) {}
+
+        bool operator*() const noexcept {
+            return (*owner_)[pos_];
+        }
+
+        bool operator[](difference_type n) const noexcept {
+            return (*owner_)[pos_ + n];
+        }
+
+        const_iterator& operator++() noexcept {
+            ++pos_;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator tmp = *this;
+            ++pos_;
+            return tmp;
+        }
+
+        const_iterator& operator--() noexcept {
+            --pos_;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept {
+            const_iterator tmp = *this;
+            --pos_;
+            return tmp;
+        }
+
+        const_iterator& operator+=(difference_type n) noexcept {
+            pos_ += n;
+            return *this;
+        }
+
+        const_iterator& operator-=(difference_type n) noexcept {
+            pos_ -= n;
+            return *this;
+        }
+
+        friend const_iterator operator+(const_iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend const_iterator operator+(difference_type n, const_iterator it) noexcept {
+            return it += n;
+        }
+
+        friend const_iterator operator-(const_iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_);
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return lhs.pos_ == rhs.pos_;
+        }
+
+        friend auto operator<=>(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return lhs.pos_ <=> rhs.pos_;
+        }
+    };
+
+private:
+    my_vector<word_type> words_;
+    size_type size_ = 0;
+
+    static size_type words_for(size_type bits) noexcept {
+        return (bits + bits_per_word - 1) / bits_per_word;
+    }
+
+    // Zeroes the unused high bits of the last word.
+    void clear_tail() noexcept {
+        size_type used = size_ % bits_per_word;
+        if (used != 0) {
+            words_.back() &= (word_type(1) << used) - 1;
+        }
+    }
+
+    void check_same_size(const bit_vector& other, const char* what) const {
+        if (size_ != other.size_) {
+            throw std::invalid_argument(what);
+        }
+    }
+
+public:
+    bit_vector() noexcept = default;
+
+    explicit bit_vector(size_type count, bool value = false)
+            : words_(words_for(count), value ? ~word_type(0) : word_type(0)), size_(count) {
+        clear_tail();
+    }
+
+    bit_vector(std::initializer_list<bool> init) {
+        reserve(init.size());
+        for (bool bit : init) {
+            push_back(bit);
+        }
+    }
+
+    reference operator[](size_type pos) noexcept {
+        return reference(&words_[pos / bits_per_word], pos % bits_per_word);
+    }
+
+    bool operator[](size_type pos) const noexcept {
+        return (words_[pos / bits_per_word] >> (pos % bits_per_word)) & 1;
+    }
+
+    reference at(size_type pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("bit_vector::at");
+        }
+        return (*this)[pos];
+    }
+
+    bool at(size_type pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("bit_vector::at");
+        }
+        return (*this)[pos];
+    }
+
+    reference front() noexcept {
+        return (*this)[0];
+    }
+
+    bool front() const noexcept {
+        return (*this)[0];
+    }
+
+    reference back() noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    bool back() const noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    // Raw word storage, bit i lives in word i / 64 at position i % 64.
+    const word_type* words() const noexcept {
+        return words_.data();
+    }
+
+    [[nodiscard]] size_type word_count() const noexcept {
+        return words_.size();
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] size_type capacity() const noexcept {
+        return words_.capacity() * bits_per_word;
+    }
+
+    void reserve(size_type new_cap) {
+        words_.reserve(words_for(new_cap));
+    }
+
+    void shrink_to_fit() {
+        words_.shrink_to_fit();
+    }
+
+    void clear() noexcept {
+        words_.clear();
+        size_ = 0;
+    }
+
+    void push_back(bool value) {
+        if (size_ % bits_per_word == 0) {
+            words_.push_back(0);
+        }
+        if (value) {
+            words_.back() |= word_type(1) << (size_ % bits_per_word);
+        }
+        ++size_;
+    }
+
+    void pop_back() noexcept {
+        if (size_ > 0) {
+            --size_;
+            if (size_ % bits_per_word == 0) {
+                words_.pop_back();
+            } else {
+                clear_tail();
+            }
+        }
+    }
+
+    void resize(size_type count, bool value = false) {
+        size_type old_size = size_;
+        if (count > old_size && value && old_size % bits_per_word != 0) {
+            words_.back() |= ~word_type(0) << (old_size % bits_per_word);
+        }
+        words_.resize(words_for(count), value ? ~word_type(0) : word_type(0));
+        size_ = count;
+        clear_tail();
+    }
+
+    void set(size_type pos, bool value = true) noexcept {
+        (*this)[pos] = value;
+    }
+
+    void reset(size_type pos) noexcept {
+        (*this)[pos] = false;
+    }
+
+    void flip(size_type pos) noexcept {
+        (*this)[pos].flip();
+    }
+
+    void set() noexcept {
+        std::fill(words_.begin(), words_.end(), ~word_type(0));
+        clear_tail();
+    }
+
+    void reset() noexcept {
+        std::fill(words_.begin(), words_.end(), word_type(0));
+    }
+
+    // Bulk NOT.
+    void flip() noexcept {
+        for (word_type& word : words_) {
+            word = ~word;
+        }
+        clear_tail();
+    }
+
+    // Number of set bits.
+    [[nodiscard]] size_type count() const noexcept {
+        size_type result = 0;
+        for (word_type word : words_) {
+            result += std::popcount(word);
+        }
+        return result;
+    }
+
+    [[nodiscard]] bool any() const noexcept {
+        for (word_type word : words_) {
+            if (word != 0) return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool none() const noexcept {
+        return !any();
+    }
+
+    [[nodiscard]] bool all() const noexcept {
+        return count() == size_;
+    }
+
+    // Index of the first set bit, or npos if there is none.
+    [[nodiscard]] size_type find_first() const noexcept {
+        for (size_type w = 0; w < words_.size(); ++w) {
+            if (words_[w] != 0) {
+                return w * bits_per_word + std::countr_zero(words_[w]);
+            }
+        }
+        return npos;
+    }
+
+    // Index of the first set bit after pos, or npos if there is none.
+    [[nodiscard]] size_type find_next(size_type pos) const noexcept {
+        ++pos;
+        if (pos >= size_) return npos;
+
+        size_type w = pos / bits_per_word;
+        word_type word = words_[w] & (~word_type(0) << (pos % bits_per_word));
+        while (word == 0) {
+            if (++w == words_.size()) return npos;
+            word = words_[w];
+        }
+        return w * bits_per_word + std::countr_zero(word);
+    }
+
+    bit_vector& operator&=(const bit_vector& other) {
+        check_same_size(other, "bit_vector::operator&=");
+        for (size_type w = 0; w < words_.size(); ++w) {
+            words_[w] &= other.words_[w];
+        }
+        return *this;
+    }
+
+    bit_vector& operator|=(const bit_vector& other) {
+        check_same_size(other, "bit_vector::operator|=");
+        for (size_type w = 0; w < words_.size(); ++w) {
+            words_[w] |= other.words_[w];
+        }
+        return *this;
+    }
+
+    bit_vector& operator^=(const bit_vector& other) {
+        check_same_size(other, "bit_vector::operator^=");
+        for (size_type w = 0; w < words_.size(); ++w) {
+            words_[w] ^= other.words_[w];
+        }
+        return *this;
+    }
+
+    bit_vector operator~() const {
+        bit_vector result(*this);
+        result.flip();
+        return result;
+    }
+
+    void swap(bit_vector& other) noexcept {
+        words_.swap(other.words_);
+        std::swap(size_, other.size_);
+    }
+
+    bool operator==(const bit_vector& other) const {
+        return size_ == other.size_ && words_ == other.words_;
+    }
+
+    bool operator!=(const bit_vector& other) const {
+        return !(*this == other);
+    }
+};
+
+inline bit_vector operator&(bit_vector lhs, const bit_vector& rhs) {
+    return lhs &= rhs;
+}
+
+inline bit_vector operator|(bit_vector lhs, const bit_vector& rhs) {
+    return lhs |= rhs;
+}
+
+inline bit_vector operator^(bit_vector lhs, const bit_vector& rhs) {
+    return lhs ^= rhs;
+}
+
+inline void swap(bit_vector& lhs, bit_vector& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif // MY_VECTOR_BIT_VECTOR_HPP
@@ -0,0 +1,512 @@
+#ifndef MY_VECTOR_CHUNK_PIPELINE_HPP
+#define MY_VECTOR_CHUNK_PIPELINE_HPP
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include "async_generator.hpp"
+#include "my_vector.hpp"
+#include "work_stealing_pool.hpp"
+
+// Streaming pipelines that pass data between stages in chunks.
+//
+// A stage is an async_generator of pooled_chunk<T>: it pulls chunks from the
+// stage before it with co_await next(), works on them (in place or into a
+// fresh chunk) and co_yields them on. Chained directly, stages run one after
+// another on the thread that pulls the last one. buffered() decouples a
+// stage: a task on a work_stealing_pool runs it ahead of its consumer into a
+// bounded queue, so both sides work at the same time, and the producer waits
+// once the queue is full. The chunks in flight are therefore limited by the
+// queue capacities, not by the length of the input. Chunks come from a
+// chunk_pool and go back to it when they are destroyed, so after warm-up no
+// chunk is allocated. drain() runs a pipeline to the end from ordinary code.
+
+template <typename T>
+class pooled_chunk;
+
+namespace detail {
+
+template <typename T>
+struct chunk_pool_state {
+    std::mutex mutex;
+    my_vector<my_vector<T>> free;
+    std::size_t chunk_capacity;
+    std::size_t max_free;
+    std::size_t allocated = 0;
+
+    chunk_pool_state(std::size_t capacity, std::size_t max_free_chunks)
+            : chunk_capacity(capacity), max_free(max_free_chunks) {}
+};
+
+} // namespace detail
+
+// Recycles the buffers of chunks. Copies share the same pool, and the pool
+// stays alive until its last chunk is gone.
+template <typename T>
+class chunk_pool {
+    std::shared_ptr<detail::chunk_pool_state<T>> state_;
+
+public:
+    // Chunks get room for chunk_capacity elements; at most max_free unused
+    // buffers are kept.
+    explicit chunk_pool(std::size_t chunk_capacity, std::size_t max_free = 16)
+            : state_(std::make_shared<detail::chunk_pool_state<T>>(chunk_capacity, max_free)) {
+        if (chunk_capacity == 0) {
+            throw std::invalid_argument("chunk_pool: chunk capacity must be positive");
+        }
+    }
+
+    // An empty chunk with at least chunk_capacity() reserved.
+    pooled_chunk<T> acquire() {
+        my_vector<T> buffer;
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            if (!state_->free.empty()) {
+                buffer = std::move(state_->free.back());
+                state_->free.pop_back();
+                return pooled_chunk<T>(std::move(buffer), state_);
+            }
+            ++state_->allocated;
+        }
+        buffer.reserve(state_->chunk_capacity);
+        return pooled_chunk<T>(std::move(buffer), state_);
+    }
+
+    [[nodiscard]] std::size_t chunk_capacity() const noexcept {
+        return state_->chunk_capacity;
+    }
+
+    // Number of buffers allocated so far.
+    [[nodiscard]] std::size_t allocated() const {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        return state_->allocated;
+    }
+};
+
+// A my_vector borrowed from a chunk_pool. It is cleared and given back when
+// the chunk is destroyed.
+template <typename T>
+class pooled_chunk {
+    friend class chunk_pool<T>;
+
+    my_vector<T> data_;
+    std::shared_ptr<detail::chunk_pool_state<T>> owner_;
+
+    pooled_chunk(my_vector<T> data, std::shared_ptr<detail::chunk_pool_state<T>> owner) noexcept
+            : data_(std::move(data)), owner_(std::move(owner)) {}
+
+    void give_back() noexcept {
+        if (!owner_) return;
+        data_.clear();
+        std::lock_guard<std::mutex> lock(owner_->mutex);
+        if (owner_->free.size() < owner_->max_free) {
+            owner_->free.push_back(std::move(data_));
+        }
+    }
+
+public:
+    pooled_chunk(pooled_chunk&& other) noexcept = default;
+
+    pooled_chunk& operator=(pooled_chunk&& other) noexcept {
+        if (this != &other) {
+            give_back();
+            data_ = std::move(other.data_);
+            owner_ = std::move(other.owner_);
+        }
+        return *this;
+    }
+
+    ~pooled_chunk() {
+        give_back();
+    }
+
+    my_vector<T>& operator*() noexcept {
+        return data_;
+    }
+
+    const my_vector<T>& operator*() const noexcept {
+        return data_;
+    }
+
+    my_vector<T>* operator->() noexcept {
+        return &data_;
+    }
+
+    const my_vector<T>* operator->() const noexcept {
+        return &data_;
+    }
+
+    // Takes the elements out for good; the buffer is not recycled.
+    my_vector<T> release() noexcept {
+        owner_.reset();
+        return std::move(data_);
+    }
+};
+
+template <typename T>
+using chunk_stream = async_generator<pooled_chunk<T>>;
+
+namespace detail {
+
+// Bounded multi-producer, multi-consumer queue for coroutines. Waiting
+// senders and receivers are resumed through the pool.
+template <typename T>
+class bounded_channel {
+    std::mutex mutex_;
+    std::deque<T> items_;
+    std::size_t capacity_;
+    work_stealing_pool& pool_;
+    bool closed_ = false;
+    std::exception_ptr error_;
+    // Pumps that were started for this channel and have not finished yet.
+    std::atomic<std::size_t> pumps_{0};
+
+    struct send_awaiter;
+    struct receive_awaiter;
+
+    std::deque<send_awaiter*> senders_;
+    std::deque<receive_awaiter*> receivers_;
+
+    void wake(std::coroutine_handle<> waiter) {
+        pool_.post([waiter] { waiter.resume(); });
+    }
+
+    struct send_awaiter {
+        bounded_channel& channel;
+        T value;
+        std::coroutine_handle<> waiter;
+        bool accepted = false;
+
+        send_awaiter(bounded_channel& owner, T item) : channel(owner), value(std::move(item)) {}
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> self) {
+            std::lock_guard<std::mutex> lock(channel.mutex_);
+            if (channel.closed_) return false;
+            if (!channel.receivers_.empty()) {
+                receive_awaiter* receiver = channel.receivers_.front();
+                channel.receivers_.pop_front();
+                receiver->value.emplace(std::move(value));
+                channel.wake(receiver->waiter);
+                accepted = true;
+                return false;
+            }
+            if (channel.items_.size() < channel.capacity_) {
+                channel.items_.push_back(std::move(value));
+                accepted = true;
+                return false;
+            }
+            waiter = self;
+            channel.senders_.push_back(this);
+            return true;
+        }
+
+        bool await_resume() const noexcept {
+            return accepted;
+        }
+    };
+
+    struct receive_awaiter {
+        bounded_channel& channel;
+        std::optional<T> value;
+        std::coroutine_handle<> waiter;
+
+        explicit receive_awaiter(bounded_channel& owner) noexcept : channel(owner) {}
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> self) {
+            std::lock_guard<std::mutex> lock(channel.mutex_);
+            if (!channel.items_.empty()) {
+                value.emplace(std::move(channel.items_.front()));
+                channel.items_.pop_front();
+                if (!channel.senders_.empty()) {
+                    send_awaiter* sender = channel.senders_.front();
+                    channel.senders_.pop_front();
+                    channel.items_.push_back(std::move(sender->value));
+                    sender->accepted = true;
+                    channel.wake(sender->waiter);
+                }
+                return false;
+            }
+            if (channel.closed_) return false;
+            waiter = self;
+            channel.receivers_.push_back(this);
+            return true;
+        }
+
+        std::optional<T> await_resume() {
+            if (!value && channel.error_) {
+                std::rethrow_exception(channel.error_);
+            }
+            return std::move(value);
+        }
+    };
+
+public:
+    bounded_channel(std::size_t capacity, work_stealing_pool& pool) : capacity_(capacity), pool_(pool) {
+        if (capacity == 0) {
+            throw std::invalid_argument("bounded_channel: capacity must be positive");
+        }
+    }
+
+    // co_await send(v) waits while the channel is full and gives false if it
+    // was closed, in which case v is dropped.
+    send_awaiter send(T value) {
+        return send_awaiter(*this, std::move(value));
+    }
+
+    // co_await receive() gives the next item, or nullopt once the channel is
+    // closed and empty. If it was closed with an error, that is rethrown.
+    receive_awaiter receive() {
+        return receive_awaiter(*this);
+    }
+
+    [[nodiscard]] bool closed() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return closed_;
+    }
+
+    void pump_started() noexcept {
+        pumps_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Called by a pump once it no longer touches its source.
+    void pump_finished() noexcept {
+        pumps_.fetch_sub(1, std::memory_order_release);
+    }
+
+    // Closes the channel and helps the pool run until every pump feeding it
+    // has finished.
+    void close_and_wait() {
+        close();
+        pool_.run_until([this] { return pumps_.load(std::memory_order_acquire) == 0; });
+    }
+
+    // Wakes all waiters. Items already queued can still be received.
+    void close(std::exception_ptr error = nullptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) return;
+        closed_ = true;
+        error_ = std::move(error);
+        for (receive_awaiter* receiver : receivers_) {
+            wake(receiver->waiter);
+        }
+        for (send_awaiter* sender : senders_) {
+            wake(sender->waiter);
+        }
+        receivers_.clear();
+        senders_.clear();
+    }
+};
+
+// Coroutine that is started by hand and destroys itself when done.
+struct detached_task {
+    struct promise_type {
+        detached_task get_return_object() noexcept {
+            return {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept {
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept {
+            std::terminate();
+        }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// Coroutine that is started by hand and can be waited for from another
+// thread. The frame is destroyed by the owner once finished() is true.
+class sync_task {
+public:
+    struct promise_type {
+        std::atomic<bool> finished{false};
+        std::exception_ptr error;
+
+        // Publishes completion after the coroutine has suspended for good.
+        struct mark_finished {
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<promise_type> self) const noexcept {
+                self.promise().finished.store(true, std::memory_order_release);
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        sync_task get_return_object() noexcept {
+            return sync_task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        mark_finished final_suspend() const noexcept {
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept {
+            error = std::current_exception();
+        }
+    };
+
+    sync_task(const sync_task&) = delete;
+    sync_task& operator=(const sync_task&) = delete;
+
+    ~sync_task() {
+        handle_.destroy();
+    }
+
+    void start() {
+        handle_.resume();
+    }
+
+    [[nodiscard]] bool finished() const noexcept {
+        return handle_.promise().finished.load(std::memory_order_acquire);
+    }
+
+    void rethrow_if_failed() const {
+        if (handle_.promise().error) {
+            std::rethrow_exception(handle_.promise().error);
+        }
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+    explicit sync_task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+};
+
+// Moves the values of source into channel until either runs out. Once the
+// channel is closed from the reading side, no further value is pulled.
+template <typename T>
+detached_task pump(async_generator<T> source, std::shared_ptr<bounded_channel<T>> channel) {
+    std::exception_ptr error;
+    {
+        // Destroyed here, so the stages behind it are gone before the pump
+        // reports that it has finished.
+        async_generator<T> stage = std::move(source);
+        try {
+            while (!channel->closed()) {
+                T* value = co_await stage.next();
+                if (!value || !co_await channel->send(std::move(*value))) break;
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    channel->close(std::move(error));
+    channel->pump_finished();
+}
+
+// The reading side's hold on a channel. However the reader ends, including
+// being destroyed before it started, the channel is closed and the pumps
+// feeding it are waited for, so none of them outlives the pipeline.
+template <typename T>
+class channel_reader {
+    std::shared_ptr<bounded_channel<T>> channel_;
+
+public:
+    explicit channel_reader(std::shared_ptr<bounded_channel<T>> channel) noexcept : channel_(std::move(channel)) {}
+
+    channel_reader(channel_reader&& other) noexcept = default;
+
+    ~channel_reader() {
+        if (channel_) channel_->close_and_wait();
+    }
+
+    bounded_channel<T>& operator*() const noexcept {
+        return *channel_;
+    }
+};
+
+template <typename T>
+async_generator<T> read_channel(channel_reader<T> channel) {
+    while (std::optional<T> value = co_await (*channel).receive()) {
+        co_yield std::move(*value);
+    }
+}
+
+template <typename T, typename Consume>
+sync_task consume_all(async_generator<T>& stream, Consume& consume) {
+    while (T* value = co_await stream.next()) {
+        consume(*value);
+    }
+}
+
+} // namespace detail
+
+// Stage that copies [first, last) into chunks of chunk_capacity() elements.
+// The range must outlive the stream.
+template <typename InputIt, typename T = typename std::iterator_traits<InputIt>::value_type>
+chunk_stream<T> chunks_of(InputIt first, InputIt last, chunk_pool<T> pool) {
+    while (first != last) {
+        pooled_chunk<T> chunk = pool.acquire();
+        for (std::size_t room = pool.chunk_capacity(); room > 0 && first != last; --room, ++first) {
+            chunk->push_back(*first);
+        }
+        co_yield std::move(chunk);
+    }
+}
+
+// Runs source on pool ahead of its consumer, holding up to capacity values
+// that were produced but not consumed yet. An exception from source reaches
+// the consumer after the values produced before it. Destroying the returned
+// stream stops source and waits until it is destroyed as well.
+template <typename T>
+async_generator<T> buffered(async_generator<T> source, std::size_t capacity,
+                            work_stealing_pool& pool = work_stealing_pool::global()) {
+    auto channel = std::make_shared<detail::bounded_channel<T>>(capacity, pool);
+    std::coroutine_handle<> producer = detail::pump(std::move(source), channel).handle;
+    channel->pump_started();
+    pool.post([producer] { producer.resume(); });
+    return detail::read_channel(detail::channel_reader<T>(std::move(channel)));
+}
+
+// Pulls every value out of stream and passes it to consume as an lvalue,
+// helping pool run the buffered stages meanwhile. Rethrows the first
+// exception from a stage or from consume.
+//
+// consume is called for one value at a time, and every call finishes before
+// drain returns. Once a buffered() stage is involved, though, the calls run
+// on whichever thread resumes the consumer: the calling thread or a worker
+// of the buffered stage's pool. consume must therefore not rely on
+// thread-local state of the caller, and what it shares with other threads
+// needs the usual synchronization.
+template <typename T, typename Consume>
+void drain(async_generator<T> stream, Consume&& consume, work_stealing_pool& pool = work_stealing_pool::global()) {
+    detail::sync_task task = detail::consume_all(stream, consume);
+    task.start();
+    pool.run_until([&task] { return task.finished(); });
+    task.rethrow_if_failed();
+}
+
+#endif //MY_VECTOR_CHUNK_PIPELINE_HPP
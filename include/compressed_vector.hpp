@@ -0,0 +1,376 @@
+#ifndef MY_VECTOR_COMPRESSED_VECTOR_HPP
+#define MY_VECTOR_COMPRESSED_VECTOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include "my_vector.hpp"
+
+// Append-only vector of unsigned integers stored in bit-packed blocks.
+//
+// Values are grouped into blocks of block_size. A full block is packed with
+// the smallest bit width that fits it, either as deltas from the previous
+// value (when the block is non-decreasing, e.g. sorted ID lists) or as
+// offsets from the block minimum (frame of reference). Every block keeps a
+// header with its base value and the offset of its bits, so random access
+// jumps straight to the block. The last, incomplete block is kept unpacked
+// until it fills up. Iterators decode a whole block when they enter it, so
+// sequential iteration costs the same per element as for_each().
+template <typename T>
+class compressed_vector {
+    static_assert(std::is_unsigned_v<T>, "compressed_vector stores unsigned integers");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = T;
+
+    static constexpr size_type block_size = 128;
+
+    class const_iterator {
+        // Decoded copy of one block, owned by one iterator. A copy of an
+        // iterator starts without it and decodes its block on first access,
+        // so copying costs no more than copying a position.
+        struct decoded_block {
+            size_type block;
+            T values[block_size];
+        };
+
+        const compressed_vector* owner_ = nullptr;
+        size_type pos_ = 0;
+        mutable std::unique_ptr<decoded_block> cache_;
+
+        const decoded_block& load(size_type block) const {
+            if (!cache_) {
+                cache_ = std::make_unique<decoded_block>();
+            }
+            owner_->decode_block(block, cache_->values);
+            cache_->block = block;
+            return *cache_;
+        }
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        const_iterator() = default;
+
+        const_iterator(const compressed_vector* owner, size_type pos) noexcept : owner_(owner), pos_(pos) {}
+
+        const_iterator(const const_iterator& other) noexcept : owner_(other.owner_), pos_(other.pos_) {}
+
+        const_iterator(const_iterator&& other) noexcept = default;
+
+        // Keeps this iterator's buffer; its contents stay valid if both
+        // iterators belong to the same vector.
+        const_iterator& operator=(const const_iterator& other) noexcept {
+            if (cache_ && owner_ != other.owner_) {
+                cache_->block = static_cast<size_type>(-1);
+            }
+            owner_ = other.owner_;
+            pos_ = other.pos_;
+            return *this;
+        }
+
+        const_iterator& operator=(const_iterator&& other) noexcept = default;
+
+        T operator*() const {
+            size_type block = pos_ / block_size;
+            if (block == owner_->blocks_.size()) {
+                return owner_->tail_[pos_ % block_size];
+            }
+            const decoded_block& decoded = cache_ && cache_->block == block ? *cache_ : load(block);
+            return decoded.values[pos_ % block_size];
+        }
+
+        T operator[](difference_type n) const {
+            return (*owner_)[pos_ + n];
+        }
+
+        const_iterator& operator++() noexcept {
+            ++pos_;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator tmp = *this;
+            ++pos_;
+            return tmp;
+        }
+
+        const_iterator& operator--() noexcept {
+            --pos_;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept {
+            const_iterator tmp = *this;
+            --pos_;
+            return tmp;
+        }
+
+        const_iterator& operator+=(difference_type n) noexcept {
+            pos_ += n;
+            return *this;
+        }
+
+        const_iterator& operator-=(difference_type n) noexcept {
+            pos_ -= n;
+            return *this;
+        }
+
+        friend const_iterator operator+(const_iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend const_iterator operator+(difference_type n, const_iterator it) noexcept {
+            return it += n;
+        }
+
+        friend const_iterator operator-(const_iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_);
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return lhs.pos_ == rhs.pos_;
+        }
+
+        friend auto operator<=>(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return lhs.pos_ <=> rhs.pos_;
+        }
+    };
+
+private:
+    struct block_header {
+        T base;
+        size_type word_offset;
+        std::uint8_t width;
+        bool delta;
+    };
+
+    my_vector<std::uint64_t> words_;
+    my_vector<block_header> blocks_;
+    my_vector<T> tail_;
+
+    static std::uint64_t width_mask(unsigned width) noexcept {
+        return width == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << width) - 1;
+    }
+
+    // Reads the field at bit without branching: words_ always ends with a
+    // zero word, so the word after the field's first one can be read
+    // unconditionally, and the split shift keeps it defined for shift == 0.
+    static std::uint64_t extract(const std::uint64_t* words, size_type bit, std::uint64_t mask) noexcept {
+        size_type index = bit / 64;
+        unsigned shift = bit % 64;
+        std::uint64_t value = (words[index] >> shift) | ((words[index + 1] << 1) << (63 - shift));
+        return value & mask;
+    }
+
+    // Packs the full tail into a new block.
+    void seal_tail() {
+        bool sorted = true;
+        T min = tail_[0];
+        for (size_type i = 1; i < block_size; ++i) {
+            sorted = sorted && tail_[i - 1] <= tail_[i];
+            min = std::min(min, tail_[i]);
+        }
+
+        block_header header{sorted ? tail_[0] : min, 0, 0, sorted};
+        std::uint64_t packed[block_size];
+        std::uint64_t all_bits = 0;
+        for (size_type i = 0; i < block_size; ++i) {
+            packed[i] = sorted ? (i == 0 ? 0 : tail_[i] - tail_[i - 1]) : tail_[i] - min;
+            all_bits |= packed[i];
+        }
+        header.width = static_cast<std::uint8_t>(std::bit_width(all_bits));
+
+        // The block starts in place of the trailing zero word and gets a new
+        // one after it (a block of width 0 still takes one word, so reads stay
+        // in bounds). Capacity grows geometrically: resize() alone would
+        // reallocate the whole array for every block.
+        size_type first_word = words_.empty() ? 0 : words_.size() - 1;
+        size_type block_words = std::max<size_type>(header.width * block_size / 64, 1);
+        size_type needed = first_word + block_words + 1;
+        if (needed > words_.capacity()) {
+            words_.reserve(std::max(needed, 2 * words_.capacity()));
+        }
+        words_.resize(needed);
+        header.word_offset = first_word;
+        std::uint64_t* out = words_.data() + first_word;
+        for (size_type i = 0; i < block_size && header.width > 0; ++i) {
+            size_type bit = i * header.width;
+            unsigned shift = bit % 64;
+            out[bit / 64] |= packed[i] << shift;
+            if (shift + header.width > 64) {
+                out[bit / 64 + 1] |= packed[i] >> (64 - shift);
+            }
+        }
+
+        blocks_.push_back(header);
+        tail_.clear();
+    }
+
+public:
+    compressed_vector() = default;
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    compressed_vector(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    compressed_vector(std::initializer_list<T> init) : compressed_vector(init.begin(), init.end()) {}
+
+    explicit compressed_vector(const my_vector<T>& values) : compressed_vector(values.begin(), values.end()) {}
+
+    T operator[](size_type pos) const noexcept {
+        size_type block = pos / block_size;
+        size_type offset = pos % block_size;
+        if (block == blocks_.size()) {
+            return tail_[offset];
+        }
+
+        const block_header& header = blocks_[block];
+        const std::uint64_t* words = words_.data() + header.word_offset;
+        std::uint64_t mask = width_mask(header.width);
+        if (!header.delta) {
+            return header.base + static_cast<T>(extract(words, offset * header.width, mask));
+        }
+        T value = header.base;
+        for (size_type i = 1; i <= offset; ++i) {
+            value += static_cast<T>(extract(words, i * header.width, mask));
+        }
+        return value;
+    }
+
+    T at(size_type pos) const {
+        if (pos >= size()) {
+            throw std::out_of_range("compressed_vector::at");
+        }
+        return (*this)[pos];
+    }
+
+    T front() const noexcept {
+        return (*this)[0];
+    }
+
+    T back() const noexcept {
+        return (*this)[size() - 1];
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size());
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return blocks_.size() * block_size + tail_.size();
+    }
+
+    // Bytes of heap storage currently in use (not counting spare capacity).
+    [[nodiscard]] size_type memory_usage() const noexcept {
+        return words_.size() * sizeof(std::uint64_t) + blocks_.size() * sizeof(block_header) +
+               tail_.size() * sizeof(T);
+    }
+
+    void push_back(T value) {
+        if (tail_.capacity() < block_size) {
+            tail_.reserve(block_size);
+        }
+        tail_.push_back(value);
+        if (tail_.size() == block_size) {
+            seal_tail();
+        }
+    }
+
+    void clear() noexcept {
+        words_.clear();
+        blocks_.clear();
+        tail_.clear();
+    }
+
+    void shrink_to_fit() {
+        words_.shrink_to_fit();
+        blocks_.shrink_to_fit();
+    }
+
+    // Decodes block_size values of the given block into out. The unpack loop
+    // is branch-free (the width and mask are fixed per block); delta blocks
+    // are then turned back into values with a prefix sum.
+    void decode_block(size_type block, T* out) const noexcept {
+        const block_header& header = blocks_[block];
+        const std::uint64_t* words = words_.data() + header.word_offset;
+        const std::uint64_t mask = width_mask(header.width);
+        const unsigned width = header.width;
+        for (size_type i = 0; i < block_size; ++i) {
+            out[i] = static_cast<T>(extract(words, i * width, mask));
+        }
+        if (header.delta) {
+            out[0] = header.base;
+            for (size_type i = 1; i < block_size; ++i) {
+                out[i] += out[i - 1];
+            }
+        } else {
+            for (size_type i = 0; i < block_size; ++i) {
+                out[i] += header.base;
+            }
+        }
+    }
+
+    // Sequential decode of all values, a block at a time.
+    template <typename F>
+    void for_each(F&& f) const {
+        T buffer[block_size];
+        for (size_type block = 0; block < blocks_.size(); ++block) {
+            decode_block(block, buffer);
+            for (size_type i = 0; i < block_size; ++i) {
+                f(buffer[i]);
+            }
+        }
+        for (T value : tail_) {
+            f(value);
+        }
+    }
+
+    my_vector<T> to_vector() const {
+        my_vector<T> result;
+        result.resize(size());
+        for (size_type block = 0; block < blocks_.size(); ++block) {
+            decode_block(block, result.data() + block * block_size);
+        }
+        std::copy(tail_.begin(), tail_.end(), result.data() + blocks_.size() * block_size);
+        return result;
+    }
+};
+
+#endif // MY_VECTOR_COMPRESSED_VECTOR_HPP
@@ -0,0 +1,316 @@
+#ifndef MY_VECTOR_D_ARY_HEAP_HPP
+#define MY_VECTOR_D_ARY_HEAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "my_vector.hpp"
+
+// Position index for d_ary_heap that does nothing; the default.
+struct no_heap_index {
+    template <typename T>
+    void placed(const T&, std::size_t) noexcept {}
+
+    template <typename T>
+    void removed(const T&) noexcept {}
+
+    void clear() noexcept {}
+};
+
+// Position index for d_ary_heap that records where each element is, keyed by
+// a small integer id taken from the element by IdOf (e.g. a vertex number in
+// Dijkstra's algorithm). Ids are used as offsets into a my_vector, so they
+// should be dense; an id may be in the heap only once at a time.
+template <typename IdOf>
+class heap_position_index {
+public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    explicit heap_position_index(IdOf id_of = IdOf()) : id_of_(std::move(id_of)) {}
+
+    template <typename T>
+    void placed(const T& value, std::size_t pos) {
+        std::size_t id = id_of_(value);
+        if (id >= positions_.size()) {
+            positions_.resize(std::max(id + 1, positions_.size() * 2), npos);
+        }
+        positions_[id] = pos;
+    }
+
+    template <typename T>
+    void removed(const T& value) noexcept {
+        positions_[id_of_(value)] = npos;
+    }
+
+    void clear() noexcept {
+        std::fill(positions_.begin(), positions_.end(), npos);
+    }
+
+    // Position of the element with this id, or npos.
+    [[nodiscard]] std::size_t position(std::size_t id) const noexcept {
+        return id < positions_.size() ? positions_[id] : npos;
+    }
+
+private:
+    IdOf id_of_;
+    my_vector<std::size_t> positions_;
+};
+
+// Priority queue stored as a d-ary heap in a my_vector.
+//
+// Each node has Arity children stored next to each other, so a level of
+// sift-down compares Arity siblings that share one or two cache lines, and
+// the tree is log2(Arity) times shallower than a binary heap. Pushes and
+// decrease_key get cheaper with the depth; pops do Arity comparisons per
+// level but touch fewer levels, which pays off once the heap no longer fits
+// in cache. Elements move into a hole instead of being swapped.
+//
+// As with std::priority_queue, top() is the element that is greatest
+// according to Compare; use std::greater for a min-heap. With a
+// heap_position_index, elements can be found by id for decrease_key, update
+// and erase.
+template <typename T, std::size_t Arity = 4, typename Compare = std::less<T>, typename Index = no_heap_index>
+class d_ary_heap {
+    static_assert(Arity >= 2, "d_ary_heap needs at least two children per node");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using value_compare = Compare;
+    using const_iterator = const T*;
+
+    static constexpr size_type arity = Arity;
+
+private:
+    my_vector<T> data_;
+    Compare comp_;
+    Index index_;
+
+    static size_type parent(size_type pos) noexcept {
+        return (pos - 1) / Arity;
+    }
+
+    static size_type first_child(size_type pos) noexcept {
+        return pos * Arity + 1;
+    }
+
+    void place(size_type pos, T&& value) {
+        data_[pos] = std::move(value);
+        index_.placed(data_[pos], pos);
+    }
+
+    // Moves value up from the hole at pos and returns where it ends.
+    size_type sift_up(size_type pos, T value) {
+        while (pos > 0) {
+            size_type up = parent(pos);
+            if (!comp_(data_[up], value)) break;
+            place(pos, std::move(data_[up]));
+            pos = up;
+        }
+        place(pos, std::move(value));
+        return pos;
+    }
+
+    // Moves value down from the hole at pos within the first n elements.
+    size_type sift_down(size_type pos, T value, size_type n) {
+        for (;;) {
+            size_type child = first_child(pos);
+            if (child >= n) break;
+            size_type last = child + Arity < n ? child + Arity : n;
+            size_type best = child;
+            for (++child; child < last; ++child) {
+                if (comp_(data_[best], data_[child])) {
+                    best = child;
+                }
+            }
+            if (!comp_(value, data_[best])) break;
+            place(pos, std::move(data_[best]));
+            pos = best;
+        }
+        place(pos, std::move(value));
+        return pos;
+    }
+
+    // Floyd's bottom-up construction, O(size).
+    void heapify() {
+        size_type n = data_.size();
+        if (n < 2) {
+            if (n == 1) index_.placed(data_[0], 0);
+            return;
+        }
+        for (size_type pos = parent(n - 1) + 1; pos < n; ++pos) {
+            index_.placed(data_[pos], pos);
+        }
+        for (size_type pos = parent(n - 1) + 1; pos-- > 0;) {
+            sift_down(pos, std::move(data_[pos]), n);
+        }
+    }
+
+    // Refills the root after the top element was taken out.
+    void fill_top() {
+        T last = std::move(data_.back());
+        data_.pop_back();
+        if (!data_.empty()) {
+            sift_down(0, std::move(last), data_.size());
+        }
+    }
+
+    size_type checked_position(size_type id) const {
+        size_type pos = index_.position(id);
+        if (pos >= data_.size()) {
+            throw std::out_of_range("d_ary_heap: id is not in the heap");
+        }
+        return pos;
+    }
+
+public:
+    d_ary_heap() = default;
+
+    explicit d_ary_heap(const Compare& comp, Index index = Index()) : comp_(comp), index_(std::move(index)) {}
+
+    explicit d_ary_heap(my_vector<T> values, const Compare& comp = Compare(), Index index = Index())
+            : data_(std::move(values)), comp_(comp), index_(std::move(index)) {
+        heapify();
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    d_ary_heap(InputIt first, InputIt last, const Compare& comp = Compare(), Index index = Index())
+            : data_(first, last), comp_(comp), index_(std::move(index)) {
+        heapify();
+    }
+
+    const_reference top() const noexcept {
+        return data_[0];
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return data_.size();
+    }
+
+    void reserve(size_type new_cap) {
+        data_.reserve(new_cap);
+    }
+
+    void clear() noexcept {
+        data_.clear();
+        index_.clear();
+    }
+
+    // The elements in heap order.
+    const my_vector<T>& container() const noexcept {
+        return data_;
+    }
+
+    const_iterator begin() const noexcept {
+        return data_.begin();
+    }
+
+    const_iterator end() const noexcept {
+        return data_.end();
+    }
+
+    const Index& index() const noexcept {
+        return index_;
+    }
+
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        data_.emplace_back(std::forward<Args>(args)...);
+        sift_up(data_.size() - 1, std::move(data_.back()));
+    }
+
+    // Adds many elements at once. When the batch is large compared to the
+    // heap, the whole heap is rebuilt in O(size) instead of sifting every
+    // element up.
+    template <typename InputIt>
+    void push_range(InputIt first, InputIt last) {
+        size_type old_size = data_.size();
+        data_.insert(data_.end(), first, last);
+        size_type added = data_.size() - old_size;
+        if (added > old_size / 2) {
+            heapify();
+            return;
+        }
+        for (size_type pos = old_size; pos < data_.size(); ++pos) {
+            sift_up(pos, std::move(data_[pos]));
+        }
+    }
+
+    template <typename Range>
+    void push_range(const Range& range) {
+        push_range(std::begin(range), std::end(range));
+    }
+
+    void pop() {
+        index_.removed(data_[0]);
+        fill_top();
+    }
+
+    // Removes and returns the top element.
+    T extract_top() {
+        index_.removed(data_[0]);
+        T result = std::move(data_[0]);
+        fill_top();
+        return result;
+    }
+
+    // The following need a heap_position_index.
+
+    [[nodiscard]] bool contains(size_type id) const noexcept {
+        return index_.position(id) < data_.size();
+    }
+
+    const_reference find(size_type id) const {
+        return data_[checked_position(id)];
+    }
+
+    // Replaces the element with this id by one that is at least as close to
+    // the top (for a min-heap: a smaller key), e.g. a shorter distance.
+    void decrease_key(size_type id, T value) {
+        sift_up(checked_position(id), std::move(value));
+    }
+
+    // Replaces the element with this id, moving it either way.
+    void update(size_type id, T value) {
+        size_type pos = checked_position(id);
+        if (pos > 0 && comp_(data_[parent(pos)], value)) {
+            sift_up(pos, std::move(value));
+        } else {
+            sift_down(pos, std::move(value), data_.size());
+        }
+    }
+
+    void erase(size_type id) {
+        size_type pos = checked_position(id);
+        index_.removed(data_[pos]);
+        T last = std::move(data_.back());
+        data_.pop_back();
+        if (pos == data_.size()) return;
+        if (pos > 0 && comp_(data_[parent(pos)], last)) {
+            sift_up(pos, std::move(last));
+        } else {
+            sift_down(pos, std::move(last), data_.size());
+        }
+    }
+};
+
+#endif //MY_VECTOR_D_ARY_HEAP_HPP
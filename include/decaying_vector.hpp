@@ -0,0 +1,327 @@
+#ifndef MY_VECTOR_DECAYING_VECTOR_HPP
+#define MY_VECTOR_DECAYING_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <mutex>
+#include <utility>
+#include "my_vector.hpp"
+#include "trim_registry.hpp"
+
+// When a decaying_vector gives its spare capacity back.
+struct capacity_decay_policy {
+    // Occupancy (size / capacity) at or below which the vector counts as idle.
+    double low_occupancy = 0.25;
+    // Number of consecutive modifications at low occupancy before shrinking.
+    std::size_t sustain_ops = 4096;
+    // Capacity that is never given back.
+    std::size_t min_capacity = 16;
+    // Enrolls the vector in trim_registry::global(), so that memory pressure
+    // can trim it from another thread; see decaying_vector.
+    bool pressure_trim = false;
+};
+
+// my_vector that shrinks its capacity by itself.
+//
+// After sustain_ops consecutive modifications with occupancy at or below
+// low_occupancy, capacity is reduced to twice the current size, so a burst
+// does not pin its peak allocation forever while normal fluctuations do not
+// cause reallocations. Decay happens on the owner's thread as the vector is
+// modified; a vector that goes idle right after a burst keeps its capacity
+// until it is modified again or shrunk with shrink_to_fit().
+//
+// With policy.pressure_trim the vector is enrolled in trim_registry::global()
+// and trim_all(), e.g. from memory_pressure_watcher, shrinks it to fit from
+// whatever thread it runs on, idle or not. Such a trim moves the elements, so
+// the vector is Lockable: trim() skips it while it is locked, and the owner of
+// an enrolled vector must hold the lock (e.g. with std::lock_guard) whenever
+// it uses the vector or keeps pointers, references or iterators into it.
+// Vectors without pressure_trim never touch the registry or the lock.
+template <typename T>
+class decaying_vector : public trimmable {
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+private:
+    my_vector<T> data_;
+    capacity_decay_policy policy_;
+    size_type low_streak_ = 0;
+    mutable std::mutex access_;
+
+    // Reallocates to exactly new_capacity (>= size()) and returns the bytes freed.
+    size_type shrink_to(size_type new_capacity) {
+        size_type old_capacity = data_.capacity();
+        if (new_capacity >= old_capacity) return 0;
+
+        my_vector<T> smaller;
+        smaller.reserve(new_capacity);
+        for (T& value : data_) {
+            smaller.push_back(std::move_if_noexcept(value));
+        }
+        data_.swap(smaller);
+        low_streak_ = 0;
+        return (old_capacity - data_.capacity()) * sizeof(T);
+    }
+
+    // Called after every modification.
+    void observe() {
+        size_type capacity = data_.capacity();
+        if (capacity <= policy_.min_capacity ||
+            static_cast<double>(data_.size()) > policy_.low_occupancy * static_cast<double>(capacity)) {
+            low_streak_ = 0;
+        } else if (++low_streak_ >= policy_.sustain_ops) {
+            shrink_to(std::max(data_.size() * 2, policy_.min_capacity));
+        }
+    }
+
+    void enroll() {
+        if (policy_.pressure_trim) {
+            trim_registry::global().enroll(this);
+        }
+    }
+
+    void adopt_policy(const capacity_decay_policy& policy) {
+        if (policy.pressure_trim != policy_.pressure_trim) {
+            if (policy.pressure_trim) {
+                trim_registry::global().enroll(this);
+            } else {
+                trim_registry::global().withdraw(this);
+            }
+        }
+        policy_ = policy;
+    }
+
+    // Takes other's place in the registry, or gives up this vector's own
+    // place, so that moving never allocates. other is no longer enrolled.
+    void take_enrollment(decaying_vector& other, bool enrolled) noexcept {
+        if (other.policy_.pressure_trim) {
+            if (enrolled) {
+                trim_registry::global().withdraw(&other);
+            } else {
+                trim_registry::global().replace(&other, this);
+            }
+            other.policy_.pressure_trim = false;
+        } else if (enrolled) {
+            trim_registry::global().withdraw(this);
+        }
+    }
+
+public:
+    explicit decaying_vector(capacity_decay_policy policy = capacity_decay_policy()) : policy_(policy) {
+        enroll();
+    }
+
+    decaying_vector(std::initializer_list<T> init, capacity_decay_policy policy = capacity_decay_policy())
+            : data_(init), policy_(policy) {
+        enroll();
+    }
+
+    decaying_vector(const decaying_vector& other) : data_(other.data_), policy_(other.policy_) {
+        enroll();
+    }
+
+    // Takes over other's enrollment; the moved-from vector is left without
+    // pressure_trim.
+    decaying_vector(decaying_vector&& other) noexcept
+            : data_(std::move(other.data_)), policy_(other.policy_), low_streak_(other.low_streak_) {
+        take_enrollment(other, false);
+    }
+
+    ~decaying_vector() override {
+        if (policy_.pressure_trim) {
+            trim_registry::global().withdraw(this);
+        }
+    }
+
+    decaying_vector& operator=(const decaying_vector& other) {
+        data_ = other.data_;
+        adopt_policy(other.policy_);
+        low_streak_ = 0;
+        return *this;
+    }
+
+    decaying_vector& operator=(decaying_vector&& other) noexcept {
+        if (this != &other) {
+            data_ = std::move(other.data_);
+            bool enrolled = policy_.pressure_trim;
+            policy_ = other.policy_;
+            low_streak_ = other.low_streak_;
+            take_enrollment(other, enrolled);
+        }
+        return *this;
+    }
+
+    // Shrinks to fit unless the vector is locked; safe from any thread while
+    // the vector is alive.
+    std::size_t trim() override {
+        std::unique_lock<std::mutex> lock(access_, std::try_to_lock);
+        if (!lock.owns_lock()) return 0;
+        return shrink_to(data_.size());
+    }
+
+    void lock() const {
+        access_.lock();
+    }
+
+    bool try_lock() const {
+        return access_.try_lock();
+    }
+
+    void unlock() const {
+        access_.unlock();
+    }
+
+    const capacity_decay_policy& policy() const noexcept {
+        return policy_;
+    }
+
+    const my_vector<T>& vector() const noexcept {
+        return data_;
+    }
+
+    reference operator[](size_type pos) noexcept {
+        return data_[pos];
+    }
+
+    const_reference operator[](size_type pos) const noexcept {
+        return data_[pos];
+    }
+
+    reference at(size_type pos) {
+        return data_.at(pos);
+    }
+
+    const_reference at(size_type pos) const {
+        return data_.at(pos);
+    }
+
+    reference front() noexcept {
+        return data_.front();
+    }
+
+    const_reference front() const noexcept {
+        return data_.front();
+    }
+
+    reference back() noexcept {
+        return data_.back();
+    }
+
+    const_reference back() const noexcept {
+        return data_.back();
+    }
+
+    pointer data() noexcept {
+        return data_.data();
+    }
+
+    const_pointer data() const noexcept {
+        return data_.data();
+    }
+
+    iterator begin() noexcept {
+        return data_.begin();
+    }
+
+    const_iterator begin() const noexcept {
+        return data_.begin();
+    }
+
+    iterator end() noexcept {
+        return data_.end();
+    }
+
+    const_iterator end() const noexcept {
+        return data_.end();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return data_.size();
+    }
+
+    [[nodiscard]] size_type capacity() const noexcept {
+        return data_.capacity();
+    }
+
+    void reserve(size_type new_cap) {
+        data_.reserve(new_cap);
+        low_streak_ = 0;
+    }
+
+    void shrink_to_fit() {
+        shrink_to(data_.size());
+    }
+
+    void clear() {
+        data_.clear();
+        observe();
+    }
+
+    void push_back(const T& value) {
+        data_.push_back(value);
+        observe();
+    }
+
+    void push_back(T&& value) {
+        data_.push_back(std::move(value));
+        observe();
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        data_.emplace_back(std::forward<Args>(args)...);
+        observe();
+        return data_.back();
+    }
+
+    void pop_back() {
+        data_.pop_back();
+        observe();
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        size_type index = pos - data_.begin();
+        data_.insert(pos, value);
+        observe();
+        return data_.begin() + index;
+    }
+
+    iterator erase(const_iterator pos) {
+        size_type index = pos - data_.begin();
+        data_.erase(pos);
+        observe();
+        return data_.begin() + index;
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        size_type index = first - data_.begin();
+        data_.erase(first, last);
+        observe();
+        return data_.begin() + index;
+    }
+
+    void resize(size_type count) {
+        data_.resize(count);
+        observe();
+    }
+
+    void resize(size_type count, const T& value) {
+        data_.resize(count, value);
+        observe();
+    }
+};
+
+#endif //MY_VECTOR_DECAYING_VECTOR_HPP
@@ -0,0 +1,125 @@
+#ifndef MY_VECTOR_EPOCH_DOMAIN_HPP
+#define MY_VECTOR_EPOCH_DOMAIN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include "my_vector.hpp"
+
+// Epoch-based deferred reclamation for read-mostly shared data.
+//
+// Readers enter a critical section with read_guard; while inside they may
+// dereference pointers loaded from shared atomics. A writer that unpublishes
+// an object hands it to retire(), and the object is deleted once every reader
+// that might still see it has left its critical section.
+//
+// Every reader thread owns a cache-line-sized slot in which it announces the
+// global epoch it saw on entry. Entering and leaving only write that slot and
+// read the global epoch, which changes only when something is retired, so
+// readers never wait and never write a cache line shared with other threads.
+// retire() tags the object with the current epoch and advances it; an object
+// is freed when no slot announces an epoch at or before its tag.
+class epoch_domain {
+    static constexpr std::uint64_t idle = std::numeric_limits<std::uint64_t>::max();
+
+    struct alignas(64) reader_slot {
+        std::atomic<std::uint64_t> epoch{idle};
+        std::atomic<bool> in_use{true};
+        // Nesting depth, only touched by the owning thread.
+        unsigned depth = 0;
+        reader_slot* next = nullptr;
+    };
+
+    // Gives the thread's slot back when the thread exits.
+    struct thread_slot {
+        reader_slot* slot = nullptr;
+
+        ~thread_slot() {
+            if (slot != nullptr) {
+                slot->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    struct retired_object {
+        void* object;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    };
+
+    std::atomic<std::uint64_t> epoch_{0};
+    // Slots are never freed, only reused by later threads.
+    std::atomic<reader_slot*> slots_{nullptr};
+    mutable std::mutex retired_mutex_;
+    my_vector<retired_object> retired_;
+
+    static thread_local thread_slot local_;
+
+    epoch_domain() = default;
+
+    reader_slot* register_thread();
+    std::size_t reclaim_locked();
+
+    void enter() {
+        reader_slot* slot = local_.slot != nullptr ? local_.slot : register_thread();
+        if (slot->depth++ == 0) {
+            slot->epoch.store(epoch_.load(std::memory_order_acquire), std::memory_order_relaxed);
+            // Orders the announcement before the reader's loads of shared
+            // pointers; pairs with the fence in reclaim_locked().
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    void leave() noexcept {
+        reader_slot* slot = local_.slot;
+        if (--slot->depth == 0) {
+            slot->epoch.store(idle, std::memory_order_release);
+        }
+    }
+
+public:
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+
+    // Process-wide domain, never destroyed.
+    static epoch_domain& global();
+
+    // Reader critical section; guards may nest on the same thread. A guard
+    // must be destroyed on the thread that created it.
+    class read_guard {
+        epoch_domain& domain_;
+
+    public:
+        explicit read_guard(epoch_domain& domain = global()) : domain_(domain) {
+            domain_.enter();
+        }
+
+        ~read_guard() {
+            domain_.leave();
+        }
+
+        read_guard(const read_guard&) = delete;
+        read_guard& operator=(const read_guard&) = delete;
+    };
+
+    // Deletes object with deleter once no reader can reach it any more. The
+    // object must already be unreachable for readers that enter from now on.
+    void retire(void* object, void (*deleter)(void*));
+
+    template <typename T>
+    void retire(const T* object) {
+        retire(const_cast<T*>(object), [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    // Frees what can be freed now and returns the number of objects freed.
+    std::size_t reclaim();
+
+    // Number of retired objects that are not freed yet.
+    [[nodiscard]] std::size_t pending() const;
+};
+
+inline thread_local epoch_domain::thread_slot epoch_domain::local_;
+
+#endif //MY_VECTOR_EPOCH_DOMAIN_HPP
@@ -0,0 +1,95 @@
+#ifndef MY_VECTOR_FLAT_HASH_MAP_HPP
+#define MY_VECTOR_FLAT_HASH_MAP_HPP
+
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "hash_table.hpp"
+
+struct flat_hash_map_key_of_value {
+    template <typename Pair>
+    const typename Pair::first_type& operator()(const Pair& pair) const noexcept {
+        return pair.first;
+    }
+};
+
+// Unordered associative array of unique keys in an open-addressing table
+// backed by my_vector storage. Elements are std::pair<const Key, T>, as in
+// std::unordered_map; they stay in place until the table rehashes.
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class flat_hash_map
+        : public hash_table<Key, std::pair<const Key, T>, flat_hash_map_key_of_value, Hash, KeyEqual> {
+    using base = hash_table<Key, std::pair<const Key, T>, flat_hash_map_key_of_value, Hash, KeyEqual>;
+
+public:
+    using mapped_type = T;
+    using typename base::const_iterator;
+    using typename base::iterator;
+    using typename base::value_type;
+
+    using base::base;
+
+    T& at(const Key& key) {
+        iterator it = this->find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("flat_hash_map::at");
+        }
+        return it->second;
+    }
+
+    const T& at(const Key& key) const {
+        const_iterator it = this->find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("flat_hash_map::at");
+        }
+        return it->second;
+    }
+
+    T& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    T& operator[](Key&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    // Constructs the element only if the key is not present yet.
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<K>, Key> ||
+                      requires { typename Hash::is_transparent; typename KeyEqual::is_transparent; }) {
+            return try_emplace_key(std::forward<K>(key), std::forward<Args>(args)...);
+        } else {
+            // Without a transparent hash and equality every probe would
+            // convert key again, so convert it once up front.
+            return try_emplace_key(Key(std::forward<K>(key)), std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj) {
+        auto result = try_emplace(std::forward<K>(key), std::forward<M>(obj));
+        if (!result.second) {
+            result.first->second = std::forward<M>(obj);
+        }
+        return result;
+    }
+
+private:
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_key(K&& key, Args&&... args) {
+        auto [index, inserted] = this->emplace_key(key, std::piecewise_construct,
+                                                   std::forward_as_tuple(std::forward<K>(key)),
+                                                   std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator(this, index), inserted};
+    }
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void swap(flat_hash_map<Key, T, Hash, KeyEqual>& lhs, flat_hash_map<Key, T, Hash, KeyEqual>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif // MY_VECTOR_FLAT_HASH_MAP_HPP
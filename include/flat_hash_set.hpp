@@ -0,0 +1,29 @@
+#ifndef MY_VECTOR_FLAT_HASH_SET_HPP
+#define MY_VECTOR_FLAT_HASH_SET_HPP
+
+#include <functional>
+#include "hash_table.hpp"
+
+struct flat_hash_set_key_of_value {
+    template <typename Key>
+    const Key& operator()(const Key& key) const noexcept {
+        return key;
+    }
+};
+
+// Unordered set of unique keys in an open-addressing table backed by
+// my_vector storage.
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class flat_hash_set : public hash_table<Key, Key, flat_hash_set_key_of_value, Hash, KeyEqual> {
+    using base = hash_table<Key, Key, flat_hash_set_key_of_value, Hash, KeyEqual>;
+
+public:
+    using base::base;
+};
+
+template <typename Key, typename Hash, typename KeyEqual>
+void swap(flat_hash_set<Key, Hash, KeyEqual>& lhs, flat_hash_set<Key, Hash, KeyEqual>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif // MY_VECTOR_FLAT_HASH_SET_HPP
@@ -0,0 +1,98 @@
+#ifndef MY_VECTOR_FLAT_MAP_HPP
+#define MY_VECTOR_FLAT_MAP_HPP
+
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "flat_tree.hpp"
+
+struct flat_map_key_of_value {
+    template <typename Pair>
+    const typename Pair::first_type& operator()(const Pair& pair) const noexcept {
+        return pair.first;
+    }
+};
+
+// Sorted associative array of unique keys stored contiguously as
+// std::pair<Key, T> in a my_vector. Mapped values may be modified through
+// iterators; modifying a key breaks the ordering and is not allowed.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map : public flat_tree<Key, std::pair<Key, T>, flat_map_key_of_value, Compare> {
+    using base = flat_tree<Key, std::pair<Key, T>, flat_map_key_of_value, Compare>;
+
+public:
+    using mapped_type = T;
+    using typename base::iterator;
+    using typename base::size_type;
+    using typename base::value_type;
+
+    using base::base;
+
+    T& at(const Key& key) {
+        iterator it = this->find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return it->second;
+    }
+
+    const T& at(const Key& key) const {
+        auto it = this->find(key);
+        if (it == this->end()) {
+            throw std::out_of_range("flat_map::at");
+        }
+        return it->second;
+    }
+
+    T& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    T& operator[](Key&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    // Constructs the mapped value only if the key is not present yet.
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<K>, Key> || requires { typename Compare::is_transparent; }) {
+            return try_emplace_key(std::forward<K>(key), std::forward<Args>(args)...);
+        } else {
+            // Without a transparent comparator every comparison would convert
+            // key again, so convert it once up front.
+            return try_emplace_key(Key(std::forward<K>(key)), std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+        auto result = try_emplace(key, std::forward<M>(obj));
+        if (!result.second) {
+            result.first->second = std::forward<M>(obj);
+        }
+        return result;
+    }
+
+private:
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_key(K&& key, Args&&... args) {
+        size_type pos = this->lower_bound_index(key);
+        if (pos != this->size() && !this->comp_(key, this->data_[pos].first)) {
+            return {this->begin() + pos, false};
+        }
+        this->drop_search_index();
+        this->data_.emplace(this->data_.begin() + pos, std::piecewise_construct,
+                            std::forward_as_tuple(std::forward<K>(key)),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+        return {this->begin() + pos, true};
+    }
+};
+
+template <typename Key, typename T, typename Compare>
+void swap(flat_map<Key, T, Compare>& lhs, flat_map<Key, T, Compare>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif // MY_VECTOR_FLAT_MAP_HPP
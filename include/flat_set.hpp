@@ -0,0 +1,28 @@
+#ifndef MY_VECTOR_FLAT_SET_HPP
+#define MY_VECTOR_FLAT_SET_HPP
+
+#include <functional>
+#include "flat_tree.hpp"
+
+struct flat_set_key_of_value {
+    template <typename Key>
+    const Key& operator()(const Key& key) const noexcept {
+        return key;
+    }
+};
+
+// Sorted set of unique keys stored contiguously in a my_vector.
+template <typename Key, typename Compare = std::less<Key>>
+class flat_set : public flat_tree<Key, Key, flat_set_key_of_value, Compare> {
+    using base = flat_tree<Key, Key, flat_set_key_of_value, Compare>;
+
+public:
+    using base::base;
+};
+
+template <typename Key, typename Compare>
+void swap(flat_set<Key, Compare>& lhs, flat_set<Key, Compare>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif // MY_VECTOR_FLAT_SET_HPP
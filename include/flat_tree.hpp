@@ -0,0 +1,383 @@
+#ifndef MY_VECTOR_FLAT_TREE_HPP
+#define MY_VECTOR_FLAT_TREE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "my_vector.hpp"
+
+// Common implementation of flat_set and flat_map: a sorted, duplicate-free
+// my_vector of values searched by key.
+//
+// Besides the usual binary search, the tree can build an optional search index
+// that stores a copy of the keys in Eytzinger (BFS) order. Descending that
+// array is branch-free and touches memory in a predictable pattern, so the
+// next levels can be prefetched while the current one is compared. The index
+// is meant for read-mostly tables: any modification drops it, and it has to be
+// rebuilt with build_search_index() once the table is loaded again.
+template <typename Key, typename Value, typename KeyOfValue, typename Compare>
+class flat_tree {
+public:
+    using key_type = Key;
+    using value_type = Value;
+    using key_compare = Compare;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Value&;
+    using const_reference = const Value&;
+    using container_type = my_vector<Value>;
+    // Sets store only keys, so their elements must never be modified in place.
+    using iterator = std::conditional_t<std::is_same_v<Key, Value>, const Value*, Value*>;
+    using const_iterator = const Value*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+protected:
+    my_vector<Value> data_;
+    Compare comp_;
+    // Search index, slot 0 is unused: index_keys_[k] is the key of
+    // data_[index_pos_[k]] and the children of slot k are 2k and 2k + 1.
+    my_vector<Key> index_keys_;
+    my_vector<size_type> index_pos_;
+
+    static const Key& key_of(const Value& value) noexcept {
+        return KeyOfValue()(value);
+    }
+
+    iterator mutable_begin() noexcept {
+        return data_.begin();
+    }
+
+    template <typename K>
+    size_type lower_bound_index(const K& key) const {
+        if (!index_pos_.empty()) {
+            return eytzinger_lower_bound(key);
+        }
+        const_iterator it = std::partition_point(data_.begin(), data_.end(),
+                                                 [&](const Value& v) { return comp_(key_of(v), key); });
+        return it - data_.begin();
+    }
+
+    template <typename K>
+    size_type upper_bound_index(const K& key) const {
+        const_iterator it = std::partition_point(data_.begin() + lower_bound_index(key), data_.end(),
+                                                 [&](const Value& v) { return !comp_(key, key_of(v)); });
+        return it - data_.begin();
+    }
+
+    template <typename K>
+    size_type find_index(const K& key) const {
+        size_type pos = lower_bound_index(key);
+        if (pos != data_.size() && !comp_(key, key_of(data_[pos]))) {
+            return pos;
+        }
+        return data_.size();
+    }
+
+    // Inserts value at its sorted position unless an equivalent key exists.
+    template <typename V>
+    std::pair<iterator, bool> insert_unique(V&& value) {
+        size_type pos = lower_bound_index(key_of(value));
+        if (pos != data_.size() && !comp_(key_of(value), key_of(data_[pos]))) {
+            return {mutable_begin() + pos, false};
+        }
+        drop_search_index();
+        data_.insert(data_.begin() + pos, std::forward<V>(value));
+        return {mutable_begin() + pos, true};
+    }
+
+private:
+    template <typename K>
+    size_type eytzinger_lower_bound(const K& key) const {
+        const size_type n = index_keys_.size() - 1;
+        const Key* keys = index_keys_.data();
+        // Children of k at depth d below it start at k * 2^d; prefetching the
+        // block one cache line wide hides the latency of the next few levels.
+        constexpr size_type prefetch_stride = sizeof(Key) < 64 ? 64 / sizeof(Key) : 1;
+
+        size_type k = 1;
+        while (k <= n) {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(keys + std::min(k * prefetch_stride, n));
+#endif
+            k = 2 * k + static_cast<size_type>(comp_(keys[k], key));
+        }
+        // The descent ends after a run of right turns following the last left
+        // turn; strip those plus the left turn to get the answer's slot.
+        k >>= std::countr_one(k) + 1;
+        return k == 0 ? data_.size() : index_pos_[k];
+    }
+
+    size_type fill_index_positions(size_type k, size_type next) {
+        if (k < index_pos_.size()) {
+            next = fill_index_positions(2 * k, next);
+            index_pos_[k] = next++;
+            next = fill_index_positions(2 * k + 1, next);
+        }
+        return next;
+    }
+
+public:
+    flat_tree() = default;
+
+    explicit flat_tree(const Compare& comp) : comp_(comp) {}
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    flat_tree(InputIt first, InputIt last, const Compare& comp = Compare()) : comp_(comp) {
+        insert(first, last);
+    }
+
+    flat_tree(std::initializer_list<Value> init, const Compare& comp = Compare())
+            : flat_tree(init.begin(), init.end(), comp) {}
+
+    iterator begin() noexcept {
+        return data_.begin();
+    }
+
+    const_iterator begin() const noexcept {
+        return data_.begin();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return data_.begin();
+    }
+
+    iterator end() noexcept {
+        return data_.end();
+    }
+
+    const_iterator end() const noexcept {
+        return data_.end();
+    }
+
+    const_iterator cend() const noexcept {
+        return data_.end();
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return data_.size();
+    }
+
+    [[nodiscard]] size_type capacity() const noexcept {
+        return data_.capacity();
+    }
+
+    void reserve(size_type new_cap) {
+        data_.reserve(new_cap);
+    }
+
+    void shrink_to_fit() {
+        data_.shrink_to_fit();
+    }
+
+    void clear() noexcept {
+        data_.clear();
+        drop_search_index();
+    }
+
+    const my_vector<Value>& sequence() const noexcept {
+        return data_;
+    }
+
+    key_compare key_comp() const {
+        return comp_;
+    }
+
+    std::pair<iterator, bool> insert(const Value& value) {
+        return insert_unique(value);
+    }
+
+    std::pair<iterator, bool> insert(Value&& value) {
+        return insert_unique(std::move(value));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert_unique(Value(std::forward<Args>(args)...));
+    }
+
+    // Bulk insertion: appends the whole range, sorts only the new tail, merges
+    // it with the existing elements and drops duplicates in a single pass.
+    // This costs O(N + M log M) instead of M insertions shifting the tail.
+    // For equivalent keys the element already present (or the first one in
+    // the range) is kept.
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    void insert(InputIt first, InputIt last) {
+        auto less = [this](const Value& lhs, const Value& rhs) { return comp_(key_of(lhs), key_of(rhs)); };
+        auto equal = [this](const Value& lhs, const Value& rhs) {
+            return !comp_(key_of(lhs), key_of(rhs)) && !comp_(key_of(rhs), key_of(lhs));
+        };
+
+        size_type old_size = data_.size();
+        for (; first != last; ++first) {
+            data_.emplace_back(*first);
+        }
+        if (data_.size() == old_size) return;
+
+        drop_search_index();
+        auto middle = data_.begin() + old_size;
+        std::stable_sort(middle, data_.end(), less);
+        std::inplace_merge(data_.begin(), middle, data_.end(), less);
+        data_.erase(std::unique(data_.begin(), data_.end(), equal), data_.end());
+    }
+
+    void insert(std::initializer_list<Value> init) {
+        insert(init.begin(), init.end());
+    }
+
+    iterator erase(const_iterator pos) {
+        drop_search_index();
+        size_type index = pos - data_.begin();
+        data_.erase(pos);
+        return mutable_begin() + index;
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        drop_search_index();
+        size_type index = first - data_.begin();
+        data_.erase(first, last);
+        return mutable_begin() + index;
+    }
+
+    size_type erase(const Key& key) {
+        size_type pos = find_index(key);
+        if (pos == data_.size()) return 0;
+        erase(data_.begin() + pos);
+        return 1;
+    }
+
+    iterator find(const Key& key) {
+        return mutable_begin() + find_index(key);
+    }
+
+    const_iterator find(const Key& key) const {
+        return data_.begin() + find_index(key);
+    }
+
+    template <typename K, typename C = Compare, typename = typename C::is_transparent>
+    iterator find(const K& key) {
+        return mutable_begin() + find_index(key);
+    }
+
+    template <typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator find(const K& key) const {
+        return data_.begin() + find_index(key);
+    }
+
+    bool contains(const Key& key) const {
+        return find_index(key) != data_.size();
+    }
+
+    template <typename K, typename C = Compare, typename = typename C::is_transparent>
+    bool contains(const K& key) const {
+        return find_index(key) != data_.size();
+    }
+
+    size_type count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <typename K, typename C = Compare, typename = typename C::is_transparent>
+    size_type count(const K& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    iterator lower_bound(const Key& key) {
+        return mutable_begin() + lower_bound_index(key);
+    }
+
+    const_iterator lower_bound(const Key& key) const {
+        return data_.begin() + lower_bound_index(key);
+    }
+
+    template <typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator lower_bound(const K& key) const {
+        return data_.begin() + lower_bound_index(key);
+    }
+
+    iterator upper_bound(const Key& key) {
+        return mutable_begin() + upper_bound_index(key);
+    }
+
+    const_iterator upper_bound(const Key& key) const {
+        return data_.begin() + upper_bound_index(key);
+    }
+
+    template <typename K, typename C = Compare, typename = typename C::is_transparent>
+    const_iterator upper_bound(const K& key) const {
+        return data_.begin() + upper_bound_index(key);
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    // Builds the Eytzinger-ordered search index over the current contents.
+    // Lookups use it until the next modification.
+    void build_search_index() {
+        size_type n = data_.size();
+        drop_search_index();
+        if (n == 0) return;
+
+        index_pos_.resize(n + 1);
+        fill_index_positions(1, 0);
+        index_pos_[0] = index_pos_[1];
+
+        index_keys_.reserve(n + 1);
+        for (size_type k = 0; k <= n; ++k) {
+            index_keys_.push_back(key_of(data_[index_pos_[k]]));
+        }
+    }
+
+    void drop_search_index() noexcept {
+        index_keys_.clear();
+        index_pos_.clear();
+    }
+
+    [[nodiscard]] bool has_search_index() const noexcept {
+        return !index_pos_.empty();
+    }
+
+    void swap(flat_tree& other) noexcept {
+        data_.swap(other.data_);
+        std::swap(comp_, other.comp_);
+        index_keys_.swap(other.index_keys_);
+        index_pos_.swap(other.index_pos_);
+    }
+
+    bool operator==(const flat_tree& other) const {
+        return data_ == other.data_;
+    }
+
+    bool operator!=(const flat_tree& other) const {
+        return !(*this == other);
+    }
+};
+
+#endif // MY_VECTOR_FLAT_TREE_HPP
@@ -0,0 +1,503 @@
+#ifndef MY_VECTOR_GAP_BUFFER_HPP
+#define MY_VECTOR_GAP_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "my_vector.hpp"
+
+// Sequence with a movable gap of unused storage, for workloads that insert
+// and erase around a cursor, like a text editor.
+//
+// The elements are stored in one allocation, as in my_vector, but the unused
+// capacity sits between the elements before the cursor and those after it:
+//
+//     [ front elements | gap | back elements ]
+//
+// Inserting or erasing at the cursor only touches the gap's edge. Inserting
+// or erasing elsewhere first moves the gap there, which costs as many element
+// moves as the distance from the cursor, so operations near the previous one
+// are amortized O(1) instead of O(size). data() moves the gap to the end and
+// returns the elements as one contiguous array.
+template <typename T>
+class gap_buffer {
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+private:
+    pointer data_ = nullptr;
+    size_type gap_begin_ = 0;
+    size_type gap_end_ = 0;
+    size_type capacity_ = 0;
+
+    size_type gap_size() const noexcept {
+        return gap_end_ - gap_begin_;
+    }
+
+    // Storage index of the element at logical position pos.
+    size_type physical(size_type pos) const noexcept {
+        return pos < gap_begin_ ? pos : pos + gap_size();
+    }
+
+    static void relocate(pointer from, pointer to, size_type count) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                std::memmove(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+            }
+        } else if (to < from) {
+            for (size_type i = 0; i < count; ++i) {
+                new (&to[i]) T(std::move(from[i]));
+                from[i].~T();
+            }
+        } else {
+            for (size_type i = count; i-- > 0;) {
+                new (&to[i]) T(std::move(from[i]));
+                from[i].~T();
+            }
+        }
+    }
+
+    void reallocate(size_type new_capacity) {
+        pointer new_data = static_cast<pointer>(::operator new(new_capacity * sizeof(T)));
+        size_type back_count = capacity_ - gap_end_;
+        relocate(data_, new_data, gap_begin_);
+        relocate(data_ + gap_end_, new_data + new_capacity - back_count, back_count);
+
+        ::operator delete(data_);
+        data_ = new_data;
+        gap_end_ = new_capacity - back_count;
+        capacity_ = new_capacity;
+    }
+
+    void grow_for(size_type count) {
+        if (gap_size() < count) {
+            reallocate(std::max(size() + count, capacity_ * 2));
+        }
+    }
+
+    void destroy_elements() noexcept {
+        for (size_type i = 0; i < gap_begin_; ++i) {
+            data_[i].~T();
+        }
+        for (size_type i = gap_end_; i < capacity_; ++i) {
+            data_[i].~T();
+        }
+        gap_begin_ = 0;
+        gap_end_ = capacity_;
+    }
+
+public:
+    template <typename V>
+    class basic_iterator {
+        friend class gap_buffer;
+        using buffer_pointer = std::conditional_t<std::is_const_v<V>, const gap_buffer*, gap_buffer*>;
+
+        buffer_pointer buffer_ = nullptr;
+        size_type pos_ = 0;
+
+        basic_iterator(buffer_pointer buffer, size_type pos) noexcept : buffer_(buffer), pos_(pos) {}
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = V*;
+        using reference = V&;
+
+        basic_iterator() = default;
+
+        // Allows iterator -> const_iterator.
+        template <typename U, typename = std::enable_if_t<std::is_const_v<V> && !std::is_const_v<U>>>
+        basic_iterator(const basic_iterator<U>& other) noexcept : buffer_(other.buffer_), pos_(other.pos_) {}
+
+        reference operator*() const noexcept {
+            return (*buffer_)[pos_];
+        }
+
+        pointer operator->() const noexcept {
+            return &(*buffer_)[pos_];
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return (*buffer_)[pos_ + n];
+        }
+
+        basic_iterator& operator++() noexcept {
+            ++pos_;
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator tmp = *this;
+            ++pos_;
+            return tmp;
+        }
+
+        basic_iterator& operator--() noexcept {
+            --pos_;
+            return *this;
+        }
+
+        basic_iterator operator--(int) noexcept {
+            basic_iterator tmp = *this;
+            --pos_;
+            return tmp;
+        }
+
+        basic_iterator& operator+=(difference_type n) noexcept {
+            pos_ += n;
+            return *this;
+        }
+
+        basic_iterator& operator-=(difference_type n) noexcept {
+            pos_ -= n;
+            return *this;
+        }
+
+        friend basic_iterator operator+(basic_iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend basic_iterator operator+(difference_type n, basic_iterator it) noexcept {
+            return it += n;
+        }
+
+        friend basic_iterator operator-(basic_iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_);
+        }
+
+        friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return lhs.pos_ == rhs.pos_;
+        }
+
+        friend auto operator<=>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return lhs.pos_ <=> rhs.pos_;
+        }
+
+        template <typename>
+        friend class basic_iterator;
+    };
+
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    gap_buffer() noexcept = default;
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    gap_buffer(InputIt first, InputIt last) {
+        try {
+            insert(end(), first, last);
+        } catch (...) {
+            destroy_elements();
+            ::operator delete(data_);
+            throw;
+        }
+    }
+
+    gap_buffer(std::initializer_list<T> init) : gap_buffer(init.begin(), init.end()) {}
+
+    gap_buffer(const gap_buffer& other) : gap_buffer(other.begin(), other.end()) {}
+
+    gap_buffer(gap_buffer&& other) noexcept
+            : data_(other.data_), gap_begin_(other.gap_begin_), gap_end_(other.gap_end_), capacity_(other.capacity_) {
+        other.data_ = nullptr;
+        other.gap_begin_ = 0;
+        other.gap_end_ = 0;
+        other.capacity_ = 0;
+    }
+
+    ~gap_buffer() {
+        destroy_elements();
+        ::operator delete(data_);
+    }
+
+    gap_buffer& operator=(const gap_buffer& other) {
+        if (this != &other) {
+            gap_buffer temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    gap_buffer& operator=(gap_buffer&& other) noexcept {
+        if (this != &other) {
+            gap_buffer temp(std::move(other));
+            swap(temp);
+        }
+        return *this;
+    }
+
+    reference operator[](size_type pos) noexcept {
+        return data_[physical(pos)];
+    }
+
+    const_reference operator[](size_type pos) const noexcept {
+        return data_[physical(pos)];
+    }
+
+    reference at(size_type pos) {
+        if (pos >= size()) {
+            throw std::out_of_range("gap_buffer::at");
+        }
+        return (*this)[pos];
+    }
+
+    const_reference at(size_type pos) const {
+        if (pos >= size()) {
+            throw std::out_of_range("gap_buffer::at");
+        }
+        return (*this)[pos];
+    }
+
+    reference front() noexcept {
+        return (*this)[0];
+    }
+
+    const_reference front() const noexcept {
+        return (*this)[0];
+    }
+
+    reference back() noexcept {
+        return (*this)[size() - 1];
+    }
+
+    const_reference back() const noexcept {
+        return (*this)[size() - 1];
+    }
+
+    // Moves the gap to the end so the elements are contiguous, and returns
+    // them. The pointer stays valid until the next modification or cursor move.
+    pointer data() {
+        move_cursor(size());
+        return data_;
+    }
+
+    my_vector<T> to_vector() const {
+        return my_vector<T>(begin(), end());
+    }
+
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(this, size());
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size());
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return capacity_ - gap_size();
+    }
+
+    [[nodiscard]] size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    // Position of the gap: the number of elements in front of it.
+    [[nodiscard]] size_type cursor() const noexcept {
+        return gap_begin_;
+    }
+
+    // Moves the gap so that it starts at position pos, moving the elements
+    // in between across it. A pos past size() moves the gap to the end.
+    void move_cursor(size_type pos) {
+        // The clamp keeps both counts below within the allocation.
+        pos = std::min(pos, size());
+        if (pos < gap_begin_) {
+            size_type count = gap_begin_ - pos;
+            relocate(data_ + pos, data_ + gap_end_ - count, count);
+            gap_begin_ -= count;
+            gap_end_ -= count;
+        } else if (pos > gap_begin_) {
+            size_type count = pos - gap_begin_;
+            relocate(data_ + gap_end_, data_ + gap_begin_, count);
+            gap_begin_ += count;
+            gap_end_ += count;
+        }
+    }
+
+    void reserve(size_type new_cap) {
+        if (new_cap > capacity_) {
+            reallocate(new_cap);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (gap_size() > 0) {
+            reallocate(size());
+        }
+    }
+
+    void clear() noexcept {
+        destroy_elements();
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type count, const T& value) {
+        T copy(value);
+        size_type index = pos.pos_;
+        grow_for(count);
+        move_cursor(index);
+        for (size_type i = 0; i < count; ++i) {
+            new (&data_[gap_begin_]) T(copy);
+            ++gap_begin_;
+        }
+        return iterator(this, index);
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        size_type index = pos.pos_;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            grow_for(std::distance(first, last));
+        }
+        move_cursor(index);
+        for (; first != last; ++first) {
+            grow_for(1);
+            new (&data_[gap_begin_]) T(*first);
+            ++gap_begin_;
+        }
+        return iterator(this, index);
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> init) {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    // Constructs the element directly in the gap when it is already at pos
+    // and has room. Otherwise the element is built first, since growing or
+    // moving the gap may move an element that args refer to.
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        size_type index = pos.pos_;
+        if (index == gap_begin_ && gap_size() > 0) {
+            new (&data_[gap_begin_]) T(std::forward<Args>(args)...);
+        } else {
+            T value(std::forward<Args>(args)...);
+            grow_for(1);
+            move_cursor(index);
+            new (&data_[gap_begin_]) T(std::move(value));
+        }
+        ++gap_begin_;
+        return iterator(this, index);
+    }
+
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        size_type index = first.pos_;
+        size_type count = last.pos_ - first.pos_;
+        move_cursor(index);
+        for (size_type i = 0; i < count; ++i) {
+            data_[gap_end_].~T();
+            ++gap_end_;
+        }
+        return iterator(this, index);
+    }
+
+    void push_back(const T& value) {
+        insert(end(), value);
+    }
+
+    void push_back(T&& value) {
+        emplace(end(), std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    void pop_back() {
+        if (!empty()) {
+            erase(end() - 1);
+        }
+    }
+
+    void swap(gap_buffer& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(gap_begin_, other.gap_begin_);
+        std::swap(gap_end_, other.gap_end_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    bool operator==(const gap_buffer& other) const {
+        return std::equal(begin(), end(), other.begin(), other.end());
+    }
+
+    bool operator!=(const gap_buffer& other) const {
+        return !(*this == other);
+    }
+};
+
+template <typename T>
+void swap(gap_buffer<T>& lhs, gap_buffer<T>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif //MY_VECTOR_GAP_BUFFER_HPP
@@ -0,0 +1,543 @@
+#ifndef MY_VECTOR_HASH_TABLE_HPP
+#define MY_VECTOR_HASH_TABLE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "my_vector.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Common implementation of flat_hash_set and flat_hash_map: an
+// open-addressing hash table in the style of Abseil's Swiss tables.
+//
+// The table keeps one control byte per slot in a my_vector<std::int8_t>: the
+// byte is empty, deleted, or holds 7 bits of the element's hash (h2). The
+// slots live in a second my_vector of raw storage. A lookup hashes the key
+// once, uses the remaining bits (h1) to pick a starting group of 16 control
+// bytes and compares h2 against the whole group at once (one SSE2 compare, or
+// a plain loop the compiler can vectorize elsewhere). Only slots whose control
+// byte matches are compared by key, and a group with an empty byte ends the
+// probe. Groups are visited in triangular order, which covers the whole table
+// because the capacity is a power of two. The control array repeats its first
+// group after the end so that a group can be loaded at any slot.
+//
+// The table grows by doubling when more than 7/8 of the slots are full or
+// deleted. Erasing leaves a deleted marker behind; growth and rehash clear
+// them.
+template <typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+class hash_table {
+    // Slots come from my_vector, which allocates with plain operator new.
+    static_assert(alignof(Value) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                  "hash_table does not support over-aligned values");
+
+public:
+    using key_type = Key;
+    using value_type = Value;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Value&;
+    using const_reference = const Value&;
+
+    static constexpr size_type group_width = 16;
+
+private:
+    static constexpr std::int8_t ctrl_empty = -128;
+    static constexpr std::int8_t ctrl_deleted = -2;
+
+    struct slot {
+        alignas(Value) unsigned char storage[sizeof(Value)];
+
+        // Leaves the storage uninitialized, so a new table is not zero-filled.
+        slot() noexcept {}
+    };
+
+    // Bitmask of the positions in a group of control bytes that match.
+    struct group {
+        const std::int8_t* ctrl;
+
+        std::uint32_t match(std::int8_t h2) const noexcept {
+#if defined(__SSE2__)
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(h2))));
+#else
+            std::uint32_t mask = 0;
+            for (size_type i = 0; i < group_width; ++i) {
+                mask |= static_cast<std::uint32_t>(ctrl[i] == h2) << i;
+            }
+            return mask;
+#endif
+        }
+
+        std::uint32_t match_empty() const noexcept {
+            return match(ctrl_empty);
+        }
+
+        // Empty and deleted bytes are the negative ones.
+        std::uint32_t match_free() const noexcept {
+#if defined(__SSE2__)
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+#else
+            std::uint32_t mask = 0;
+            for (size_type i = 0; i < group_width; ++i) {
+                mask |= static_cast<std::uint32_t>(ctrl[i] < 0) << i;
+            }
+            return mask;
+#endif
+        }
+    };
+
+    my_vector<std::int8_t> ctrl_;
+    my_vector<slot> slots_;
+    size_type size_ = 0;
+    size_type deleted_ = 0;
+    Hash hash_;
+    KeyEqual equal_;
+
+    static const Key& key_of(const Value& value) noexcept {
+        return KeyOfValue()(value);
+    }
+
+    // Spreads the bits of weak hashes (std::hash of integers is the identity).
+    static std::uint64_t mix(std::uint64_t h) noexcept {
+        h ^= h >> 32;
+        h *= 0x9e3779b97f4a7c15ULL;
+        return h ^ (h >> 29);
+    }
+
+    size_type capacity_mask() const noexcept {
+        return slots_.size() - 1;
+    }
+
+    Value* value_at(size_type index) noexcept {
+        return std::launder(reinterpret_cast<Value*>(slots_[index].storage));
+    }
+
+    const Value* value_at(size_type index) const noexcept {
+        return std::launder(reinterpret_cast<const Value*>(slots_[index].storage));
+    }
+
+    void set_ctrl(size_type index, std::int8_t value) noexcept {
+        ctrl_[index] = value;
+        if (index < group_width) {
+            ctrl_[slots_.size() + index] = value;
+        }
+    }
+
+    template <typename K>
+    std::uint64_t hash_of(const K& key) const {
+        return mix(hash_(key));
+    }
+
+    // Index of the slot holding key with hash h, or slots_.size() if absent.
+    template <typename K>
+    size_type find_index(const K& key, std::uint64_t h) const {
+        if (size_ == 0) return slots_.size();
+        auto h2 = static_cast<std::int8_t>(h & 0x7f);
+        size_type mask = capacity_mask();
+        size_type pos = (h >> 7) & mask;
+        for (size_type step = group_width;; step += group_width) {
+            group g{ctrl_.data() + pos};
+            for (std::uint32_t bits = g.match(h2); bits != 0; bits &= bits - 1) {
+                size_type index = (pos + std::countr_zero(bits)) & mask;
+                if (equal_(key_of(*value_at(index)), key)) {
+                    return index;
+                }
+            }
+            if (g.match_empty() != 0) return slots_.size();
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // First empty or deleted slot on the probe sequence of hash h.
+    size_type find_free(std::uint64_t h) const noexcept {
+        size_type mask = capacity_mask();
+        size_type pos = (h >> 7) & mask;
+        for (size_type step = group_width;; step += group_width) {
+            std::uint32_t bits = group{ctrl_.data() + pos}.match_free();
+            if (bits != 0) {
+                return (pos + std::countr_zero(bits)) & mask;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    void resize_table(size_type new_capacity) {
+        if (new_capacity > std::numeric_limits<size_type>::max() / sizeof(slot) - group_width) {
+            throw std::length_error("hash_table: too many slots");
+        }
+        my_vector<std::int8_t> old_ctrl(new_capacity + group_width, ctrl_empty);
+        my_vector<slot> old_slots(new_capacity);
+        old_ctrl.swap(ctrl_);
+        old_slots.swap(slots_);
+        size_type old_deleted = std::exchange(deleted_, 0);
+
+        // The old values stay alive until every one has been placed. If a
+        // copy throws, the values placed so far are destroyed and the old
+        // table is put back as it was.
+        try {
+            for (size_type i = 0; i < old_slots.size(); ++i) {
+                if (old_ctrl[i] < 0) continue;
+                Value* old_value = std::launder(reinterpret_cast<Value*>(old_slots[i].storage));
+                std::uint64_t h = hash_of(key_of(*old_value));
+                size_type index = find_free(h);
+                new (slots_[index].storage) Value(std::move_if_noexcept(*old_value));
+                set_ctrl(index, static_cast<std::int8_t>(h & 0x7f));
+            }
+        } catch (...) {
+            destroy_values();
+            old_ctrl.swap(ctrl_);
+            old_slots.swap(slots_);
+            deleted_ = old_deleted;
+            throw;
+        }
+
+        for (size_type i = 0; i < old_slots.size(); ++i) {
+            if (old_ctrl[i] >= 0) {
+                std::launder(reinterpret_cast<Value*>(old_slots[i].storage))->~Value();
+            }
+        }
+    }
+
+    static size_type capacity_for(size_type count) noexcept {
+        return std::max(group_width, std::bit_ceil(count + count / 7 + 1));
+    }
+
+    void destroy_values() noexcept {
+        for (size_type i = 0; i < slots_.size(); ++i) {
+            if (ctrl_[i] >= 0) {
+                value_at(i)->~Value();
+            }
+        }
+    }
+
+protected:
+    // Inserts a value built from args unless key is present. Returns the slot
+    // index and whether the value was inserted.
+    template <typename K, typename... Args>
+    std::pair<size_type, bool> emplace_key(const K& key, Args&&... args) {
+        std::uint64_t h = hash_of(key);
+        size_type found = find_index(key, h);
+        if (found != slots_.size()) return {found, false};
+
+        if ((size_ + deleted_ + 1) * 8 > slots_.size() * 7) {
+            // args may refer to an element that the rehash moves, so build
+            // the value before it.
+            Value value(std::forward<Args>(args)...);
+            // When most of the used slots are deleted markers, rebuilding at
+            // the same capacity is enough.
+            bool mostly_deleted = size_ * 4 < slots_.size();
+            resize_table(mostly_deleted ? slots_.size() : std::max(group_width, slots_.size() * 2));
+            return {place(h, std::move(value)), true};
+        }
+        return {place(h, std::forward<Args>(args)...), true};
+    }
+
+private:
+    // Constructs a value with hash h in a free slot, which must exist.
+    template <typename... Args>
+    size_type place(std::uint64_t h, Args&&... args) {
+        size_type index = find_free(h);
+        bool reuses_deleted = ctrl_[index] == ctrl_deleted;
+        new (slots_[index].storage) Value(std::forward<Args>(args)...);
+        // Only count the marker as reused once construction succeeded.
+        if (reuses_deleted) {
+            --deleted_;
+        }
+        set_ctrl(index, static_cast<std::int8_t>(h & 0x7f));
+        ++size_;
+        return index;
+    }
+
+public:
+    template <typename V>
+    class basic_iterator {
+        friend class hash_table;
+        using table_pointer = std::conditional_t<std::is_const_v<V>, const hash_table*, hash_table*>;
+
+        table_pointer table_ = nullptr;
+        size_type index_ = 0;
+
+        void skip_free() noexcept {
+            while (index_ < table_->slots_.size() && table_->ctrl_[index_] < 0) {
+                ++index_;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = V*;
+        using reference = V&;
+
+        basic_iterator() = default;
+
+        basic_iterator(table_pointer table, size_type index) noexcept : table_(table), index_(index) {
+            skip_free();
+        }
+
+        // Allows iterator -> const_iterator.
+        template <typename U, typename = std::enable_if_t<std::is_const_v<V> && !std::is_const_v<U>>>
+        basic_iterator(const basic_iterator<U>& other) noexcept : table_(other.table_), index_(other.index_) {}
+
+        reference operator*() const noexcept {
+            return *table_->value_at(index_);
+        }
+
+        pointer operator->() const noexcept {
+            return table_->value_at(index_);
+        }
+
+        basic_iterator& operator++() noexcept {
+            ++index_;
+            skip_free();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        template <typename>
+        friend class basic_iterator;
+    };
+
+    // Sets store only keys, so their elements must never be modified in place.
+    using iterator = basic_iterator<std::conditional_t<std::is_same_v<Key, Value>, const Value, Value>>;
+    using const_iterator = basic_iterator<const Value>;
+
+    hash_table() = default;
+
+    explicit hash_table(size_type bucket_count, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+            : hash_(hash), equal_(equal) {
+        reserve(bucket_count);
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    hash_table(InputIt first, InputIt last) {
+        insert(first, last);
+    }
+
+    hash_table(std::initializer_list<Value> init) : hash_table(init.begin(), init.end()) {}
+
+    hash_table(const hash_table& other) : hash_(other.hash_), equal_(other.equal_) {
+        reserve(other.size_);
+        for (const Value& value : other) {
+            emplace_key(key_of(value), value);
+        }
+    }
+
+    hash_table(hash_table&& other) noexcept
+            : ctrl_(std::move(other.ctrl_)), slots_(std::move(other.slots_)), size_(other.size_),
+              deleted_(other.deleted_), hash_(other.hash_), equal_(other.equal_) {
+        other.size_ = 0;
+        other.deleted_ = 0;
+    }
+
+    ~hash_table() {
+        destroy_values();
+    }
+
+    hash_table& operator=(const hash_table& other) {
+        if (this != &other) {
+            hash_table temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    hash_table& operator=(hash_table&& other) noexcept {
+        if (this != &other) {
+            hash_table temp(std::move(other));
+            swap(temp);
+        }
+        return *this;
+    }
+
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(this, slots_.size());
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, slots_.size());
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] size_type bucket_count() const noexcept {
+        return slots_.size();
+    }
+
+    [[nodiscard]] double load_factor() const noexcept {
+        return slots_.empty() ? 0.0 : static_cast<double>(size_) / static_cast<double>(slots_.size());
+    }
+
+    // Makes room for count elements without further rehashing.
+    void reserve(size_type count) {
+        if (count == 0) return;
+        size_type needed = capacity_for(count);
+        if (needed > slots_.size()) {
+            resize_table(needed);
+        }
+    }
+
+    // Rebuilds the table with at least bucket_count slots (and enough for the
+    // current elements), dropping all deleted markers.
+    void rehash(size_type bucket_count) {
+        size_type needed = std::max(bucket_count == 0 ? 0 : std::bit_ceil(bucket_count), capacity_for(size_));
+        resize_table(size_ == 0 && bucket_count == 0 ? 0 : std::max(needed, group_width));
+    }
+
+    void clear() noexcept {
+        destroy_values();
+        std::fill(ctrl_.begin(), ctrl_.end(), ctrl_empty);
+        size_ = 0;
+        deleted_ = 0;
+    }
+
+    std::pair<iterator, bool> insert(const Value& value) {
+        auto [index, inserted] = emplace_key(key_of(value), value);
+        return {iterator(this, index), inserted};
+    }
+
+    std::pair<iterator, bool> insert(Value&& value) {
+        auto [index, inserted] = emplace_key(key_of(value), std::move(value));
+        return {iterator(this, index), inserted};
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    void insert(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            reserve(size_ + std::distance(first, last));
+        }
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    void insert(std::initializer_list<Value> init) {
+        insert(init.begin(), init.end());
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        Value value(std::forward<Args>(args)...);
+        auto [index, inserted] = emplace_key(key_of(value), std::move(value));
+        return {iterator(this, index), inserted};
+    }
+
+    iterator erase(const_iterator pos) {
+        size_type index = pos.index_;
+        value_at(index)->~Value();
+        set_ctrl(index, ctrl_deleted);
+        --size_;
+        ++deleted_;
+        return iterator(this, index + 1);
+    }
+
+    size_type erase(const Key& key) {
+        size_type index = find_index(key, hash_of(key));
+        if (index == slots_.size()) return 0;
+        erase(const_iterator(this, index));
+        return 1;
+    }
+
+    iterator find(const Key& key) {
+        return iterator(this, find_index(key, hash_of(key)));
+    }
+
+    const_iterator find(const Key& key) const {
+        return const_iterator(this, find_index(key, hash_of(key)));
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual,
+              typename = typename H::is_transparent, typename = typename E::is_transparent>
+    iterator find(const K& key) {
+        return iterator(this, find_index(key, hash_of(key)));
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual,
+              typename = typename H::is_transparent, typename = typename E::is_transparent>
+    const_iterator find(const K& key) const {
+        return const_iterator(this, find_index(key, hash_of(key)));
+    }
+
+    bool contains(const Key& key) const {
+        return find_index(key, hash_of(key)) != slots_.size();
+    }
+
+    template <typename K, typename H = Hash, typename E = KeyEqual,
+              typename = typename H::is_transparent, typename = typename E::is_transparent>
+    bool contains(const K& key) const {
+        return find_index(key, hash_of(key)) != slots_.size();
+    }
+
+    size_type count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    hasher hash_function() const {
+        return hash_;
+    }
+
+    key_equal key_eq() const {
+        return equal_;
+    }
+
+    void swap(hash_table& other) noexcept {
+        ctrl_.swap(other.ctrl_);
+        slots_.swap(other.slots_);
+        std::swap(size_, other.size_);
+        std::swap(deleted_, other.deleted_);
+        std::swap(hash_, other.hash_);
+        std::swap(equal_, other.equal_);
+    }
+};
+
+#endif //MY_VECTOR_HASH_TABLE_HPP
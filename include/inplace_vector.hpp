@@ -0,0 +1,466 @@
+#ifndef MY_VECTOR_INPLACE_VECTOR_HPP
+#define MY_VECTOR_INPLACE_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Vector with a fixed capacity N and inline storage: it never allocates.
+//
+// Unlike my_array, the size changes at run time and only the first size()
+// slots hold constructed elements. Operations that would exceed N throw
+// std::length_error; the try_* variants return nullptr instead and never
+// throw on a full vector. When T is trivially copyable, so is the whole
+// inplace_vector, and copies are plain memberwise copies of the storage.
+template <typename T, std::size_t N>
+class inplace_vector {
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+private:
+    alignas(T) unsigned char storage_[N == 0 ? 1 : N * sizeof(T)];
+    size_type size_ = 0;
+
+    void check_room(size_type count, const char* what) const {
+        if (count > N - size_) {
+            throw std::length_error(what);
+        }
+    }
+
+    void destroy_from(size_type first) noexcept {
+        for (size_type i = first; i < size_; ++i) {
+            data()[i].~T();
+        }
+        size_ = first;
+    }
+
+    template <typename It>
+    void construct_back(It first, It last) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+public:
+    inplace_vector() noexcept = default;
+
+    explicit inplace_vector(size_type count) {
+        check_room(count, "inplace_vector: count exceeds capacity");
+        try {
+            for (; size_ < count; ++size_) {
+                new (data() + size_) T();
+            }
+        } catch (...) {
+            destroy_from(0);
+            throw;
+        }
+    }
+
+    inplace_vector(size_type count, const T& value) {
+        check_room(count, "inplace_vector: count exceeds capacity");
+        try {
+            for (; size_ < count; ++size_) {
+                new (data() + size_) T(value);
+            }
+        } catch (...) {
+            destroy_from(0);
+            throw;
+        }
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    inplace_vector(InputIt first, InputIt last) {
+        try {
+            construct_back(first, last);
+        } catch (...) {
+            destroy_from(0);
+            throw;
+        }
+    }
+
+    inplace_vector(std::initializer_list<T> init) : inplace_vector(init.begin(), init.end()) {}
+
+    // Trivially copyable T: the defaulted members copy the storage as is.
+
+    inplace_vector(const inplace_vector&) requires std::is_trivially_copy_constructible_v<T> = default;
+
+    inplace_vector(const inplace_vector& other) : inplace_vector(other.begin(), other.end()) {}
+
+    inplace_vector(inplace_vector&&) noexcept requires std::is_trivially_move_constructible_v<T> = default;
+
+    inplace_vector(inplace_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if constexpr (std::is_nothrow_move_constructible_v<T>) {
+            for (; size_ < other.size_; ++size_) {
+                new (data() + size_) T(std::move(other[size_]));
+            }
+        } else {
+            try {
+                construct_back(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            } catch (...) {
+                destroy_from(0);
+                throw;
+            }
+        }
+    }
+
+    ~inplace_vector() requires std::is_trivially_destructible_v<T> = default;
+
+    ~inplace_vector() {
+        destroy_from(0);
+    }
+
+    inplace_vector& operator=(const inplace_vector&)
+            requires std::is_trivially_copy_assignable_v<T> && std::is_trivially_copy_constructible_v<T> &&
+                     std::is_trivially_destructible_v<T> = default;
+
+    inplace_vector& operator=(const inplace_vector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    inplace_vector& operator=(inplace_vector&&) noexcept
+            requires std::is_trivially_move_assignable_v<T> && std::is_trivially_move_constructible_v<T> &&
+                     std::is_trivially_destructible_v<T> = default;
+
+    inplace_vector& operator=(inplace_vector&& other) noexcept(std::is_nothrow_move_assignable_v<T> &&
+                                                                std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+        return *this;
+    }
+
+    inplace_vector& operator=(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    // Replaces the contents, assigning over existing elements where possible.
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    void assign(InputIt first, InputIt last) {
+        size_type i = 0;
+        for (; i < size_ && first != last; ++i, ++first) {
+            data()[i] = *first;
+        }
+        destroy_from(i);
+        construct_back(first, last);
+    }
+
+    reference operator[](size_type pos) noexcept {
+        return data()[pos];
+    }
+
+    const_reference operator[](size_type pos) const noexcept {
+        return data()[pos];
+    }
+
+    reference at(size_type pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("inplace_vector::at");
+        }
+        return data()[pos];
+    }
+
+    const_reference at(size_type pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("inplace_vector::at");
+        }
+        return data()[pos];
+    }
+
+    reference front() noexcept {
+        return data()[0];
+    }
+
+    const_reference front() const noexcept {
+        return data()[0];
+    }
+
+    reference back() noexcept {
+        return data()[size_ - 1];
+    }
+
+    const_reference back() const noexcept {
+        return data()[size_ - 1];
+    }
+
+    pointer data() noexcept {
+        return std::launder(reinterpret_cast<T*>(storage_));
+    }
+
+    const_pointer data() const noexcept {
+        return std::launder(reinterpret_cast<const T*>(storage_));
+    }
+
+    iterator begin() noexcept {
+        return data();
+    }
+
+    const_iterator begin() const noexcept {
+        return data();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return data();
+    }
+
+    iterator end() noexcept {
+        return data() + size_;
+    }
+
+    const_iterator end() const noexcept {
+        return data() + size_;
+    }
+
+    const_iterator cend() const noexcept {
+        return data() + size_;
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator crbegin() const noexcept {
+        return const_reverse_iterator(cend());
+    }
+
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crend() const noexcept {
+        return const_reverse_iterator(cbegin());
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] bool full() const noexcept {
+        return size_ == N;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] static constexpr size_type capacity() noexcept {
+        return N;
+    }
+
+    [[nodiscard]] static constexpr size_type max_size() noexcept {
+        return N;
+    }
+
+    void clear() noexcept {
+        destroy_from(0);
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        check_room(1, "inplace_vector::emplace_back");
+        new (end()) T(std::forward<Args>(args)...);
+        ++size_;
+        return back();
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // Returns a pointer to the new element, or nullptr if the vector is full.
+    template <typename... Args>
+    pointer try_emplace_back(Args&&... args) {
+        if (size_ == N) return nullptr;
+        pointer p = new (end()) T(std::forward<Args>(args)...);
+        ++size_;
+        return p;
+    }
+
+    pointer try_push_back(const T& value) {
+        return try_emplace_back(value);
+    }
+
+    pointer try_push_back(T&& value) {
+        return try_emplace_back(std::move(value));
+    }
+
+    void pop_back() noexcept {
+        if (size_ > 0) {
+            --size_;
+            data()[size_].~T();
+        }
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        size_type index = pos - begin();
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + index, end() - 1, end());
+        return begin() + index;
+    }
+
+    // Returns an iterator to the new element, or nullptr if the vector is full.
+    template <typename... Args>
+    iterator try_emplace(const_iterator pos, Args&&... args) {
+        size_type index = pos - begin();
+        if (try_emplace_back(std::forward<Args>(args)...) == nullptr) return nullptr;
+        std::rotate(begin() + index, end() - 1, end());
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type count, const T& value) {
+        check_room(count, "inplace_vector::insert");
+        size_type index = pos - begin();
+        size_type old_size = size_;
+        try {
+            for (size_type i = 0; i < count; ++i) {
+                emplace_back(value);
+            }
+        } catch (...) {
+            destroy_from(old_size);
+            throw;
+        }
+        std::rotate(begin() + index, begin() + old_size, end());
+        return begin() + index;
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        size_type index = pos - begin();
+        size_type old_size = size_;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            check_room(std::distance(first, last), "inplace_vector::insert");
+        }
+        try {
+            construct_back(first, last);
+        } catch (...) {
+            destroy_from(old_size);
+            throw;
+        }
+        std::rotate(begin() + index, begin() + old_size, end());
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> init) {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        iterator target = begin() + (first - begin());
+        if (first != last) {
+            iterator new_end = std::move(target + (last - first), end(), target);
+            destroy_from(new_end - begin());
+        }
+        return target;
+    }
+
+    void resize(size_type count) {
+        if (count > size_) {
+            check_room(count - size_, "inplace_vector::resize");
+            while (size_ < count) {
+                emplace_back();
+            }
+        } else {
+            destroy_from(count);
+        }
+    }
+
+    void resize(size_type count, const T& value) {
+        if (count > size_) {
+            check_room(count - size_, "inplace_vector::resize");
+            while (size_ < count) {
+                emplace_back(value);
+            }
+        } else {
+            destroy_from(count);
+        }
+    }
+
+    void swap(inplace_vector& other) noexcept(std::is_nothrow_swappable_v<T> &&
+                                              std::is_nothrow_move_constructible_v<T>) {
+        inplace_vector& shorter = size_ < other.size_ ? *this : other;
+        inplace_vector& longer = size_ < other.size_ ? other : *this;
+        size_type common = shorter.size_;
+        std::swap_ranges(shorter.begin(), shorter.begin() + common, longer.begin());
+        shorter.construct_back(std::make_move_iterator(longer.begin() + common),
+                               std::make_move_iterator(longer.end()));
+        longer.destroy_from(common);
+    }
+
+    bool operator==(const inplace_vector& other) const {
+        return std::equal(begin(), end(), other.begin(), other.end());
+    }
+
+    bool operator!=(const inplace_vector& other) const {
+        return !(*this == other);
+    }
+
+    bool operator<(const inplace_vector& other) const {
+        return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+    }
+
+    bool operator<=(const inplace_vector& other) const {
+        return !(other < *this);
+    }
+
+    bool operator>(const inplace_vector& other) const {
+        return other < *this;
+    }
+
+    bool operator>=(const inplace_vector& other) const {
+        return !(*this < other);
+    }
+};
+
+template <typename T, std::size_t N>
+void swap(inplace_vector<T, N>& lhs, inplace_vector<T, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+#endif //MY_VECTOR_INPLACE_VECTOR_HPP
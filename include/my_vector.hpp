@@ -3,13 +3,17 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 template <typename T>
 class my_vector {
 public:
+    using value_type = T;
     using reference = T&;
     using const_reference = const T&;
     using pointer = T*;
@@ -19,8 +23,13 @@ public:
     using reverse_iterator = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
     using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
 
 private:
+    template <typename It>
+    static constexpr bool is_forward_iterator = std::is_base_of_v<
+            std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>;
+
     pointer data_ = nullptr;
     size_type size_ = 0;
     size_type capacity_ = 0;
@@ -87,6 +96,20 @@ public:
     template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
             std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
     my_vector(InputIt first, InputIt last) {
+        if constexpr (!is_forward_iterator<InputIt>) {
+            // Single-pass source: the length is unknown, grow geometrically.
+            try {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            } catch (...) {
+                destroy_elements();
+                ::operator delete(data_);
+                throw;
+            }
+            return;
+        }
+
         size_type count = std::distance(first, last);
         if (count > 0) {
             data_ = static_cast<pointer>(::operator new(count * sizeof(T)));
@@ -275,6 +298,24 @@ public:
         destroy_elements();
     }
 
+    // Lets op write elements straight into the storage, without constructing
+    // them first. op(data(), count) is called after capacity is grown to at
+    // least count and returns the new size (at most count); every element
+    // below the new size must have been written by op or kept from before.
+    // Only for trivially copyable T, e.g. to read binary data in place.
+    template <typename Operation>
+    void resize_and_overwrite(size_type count, Operation op) {
+        static_assert(std::is_trivially_copyable_v<T>, "my_vector::resize_and_overwrite needs trivially copyable T");
+        if (count > capacity_) {
+            reserve(std::max(count, capacity_ * 2));
+        }
+        size_type new_size = op(data_, count);
+        if (new_size > count) {
+            throw std::length_error("my_vector::resize_and_overwrite");
+        }
+        size_ = new_size;
+    }
+
     iterator insert(const_iterator pos, const T& value) {
         return emplace(pos, value);
     }
@@ -292,15 +333,15 @@ public:
             reserve(new_capacity);
         }
 
-        pos = begin() + index;
+        iterator target = begin() + index;
 
-        for (auto it = end() + count - 1; it != pos + count - 1; --it) {
+        for (auto it = end() + count - 1; it != target + count - 1; --it) {
             new (&*it) T(std::move(*(it - count)));
             (it - count)->~T();
         }
 
         for (size_type i = 0; i < count; ++i) {
-            new (&*(pos + i)) T(value);
+            new (&*(target + i)) T(value);
         }
 
         size_ += count;
@@ -310,6 +351,25 @@ public:
     template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
             std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
     iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        if constexpr (!is_forward_iterator<InputIt>) {
+            // Single-pass source: append in one pass, then rotate into place.
+            size_type index = pos - begin();
+            size_type old_size = size_;
+            try {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            } catch (...) {
+                // Drop what was appended so far; the old elements are untouched.
+                while (size_ > old_size) {
+                    pop_back();
+                }
+                throw;
+            }
+            std::rotate(begin() + index, begin() + old_size, end());
+            return begin() + index;
+        }
+
         size_type count = std::distance(first, last);
         if (count == 0) return const_cast<iterator>(pos);
 
@@ -319,15 +379,15 @@ public:
             reserve(new_capacity);
         }
 
-        pos = begin() + index;
+        iterator target = begin() + index;
 
-        for (auto it = end() + count - 1; it != pos + count - 1; --it) {
+        for (auto it = end() + count - 1; it != target + count - 1; --it) {
             new (&*it) T(std::move(*(it - count)));
             (it - count)->~T();
         }
 
         for (size_type i = 0; i < count; ++i, ++first) {
-            new (&*(pos + i)) T(*first);
+            new (&*(target + i)) T(*first);
         }
 
         size_ += count;
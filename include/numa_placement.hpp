@@ -0,0 +1,91 @@
+#ifndef MY_VECTOR_NUMA_PLACEMENT_HPP
+#define MY_VECTOR_NUMA_PLACEMENT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include "my_vector.hpp"
+#include "parallel_algorithms.hpp"
+
+// NUMA placement of my_vector storage.
+//
+//  - local:       pages go to the node of the thread that first touches them
+//                 (the kernel default, made explicit);
+//  - interleaved: pages are spread round-robin over all nodes, which evens out
+//                 bandwidth for data read by every socket;
+//  - partitioned: consecutive chunks are preferred on consecutive nodes, for
+//                 data that is processed chunk-wise by per-node workers.
+//
+// Policies are applied with mbind(2) and set_mempolicy(2). On single-node
+// machines, non-Linux systems or kernels without NUMA support every call is a
+// no-op, so the same code runs everywhere.
+enum class numa_policy {
+    local,
+    interleaved,
+    partitioned
+};
+
+// Number of NUMA nodes that have memory, 1 if unknown. Node ids need not be
+// contiguous: placement only ever uses the nodes that have memory.
+unsigned numa_node_count();
+
+namespace detail {
+
+// Bit i is set for node i.
+using numa_node_mask = unsigned long;
+
+// Parses a sysfs node list such as "0-1,3" into the set of nodes it names.
+// Nodes beyond the width of the mask are ignored.
+numa_node_mask parse_numa_node_list(const std::string& list);
+
+} // namespace detail
+
+// Applies the policy to the whole pages inside [addr, addr + bytes). For
+// partitioned placement chunk_bytes (rounded up to pages) is the size of the
+// piece given to each node. Pages that are already present are migrated.
+// Returns false if nothing was done (single node or unsupported).
+bool numa_bind(void* addr, std::size_t bytes, numa_policy policy, std::size_t chunk_bytes = 0);
+
+// Sets the memory policy of the calling thread for its lifetime, so every
+// page this thread touches first (e.g. while constructing a my_vector of any
+// element type) follows the policy. Partitioned placement is not available
+// per thread and behaves as interleaved here.
+class numa_thread_policy {
+public:
+    explicit numa_thread_policy(numa_policy policy);
+    ~numa_thread_policy();
+
+    numa_thread_policy(const numa_thread_policy&) = delete;
+    numa_thread_policy& operator=(const numa_thread_policy&) = delete;
+
+private:
+    bool active_ = false;
+};
+
+// Creates a vector of count copies of value whose storage is placed with the
+// given policy before any page is touched. The pages are then first-touched
+// in parallel on the work-stealing pool, so with the local policy every
+// worker's node receives part of the vector. T must be trivially copyable as
+// the elements are written directly into the fresh storage.
+template <typename T>
+my_vector<T> make_numa_vector(std::size_t count, const T& value, numa_policy policy,
+                              std::size_t chunk_elements = 0) {
+    static_assert(std::is_trivially_copyable_v<T>, "make_numa_vector needs trivially copyable T");
+
+    my_vector<T> result;
+    if (chunk_elements == 0) {
+        chunk_elements = std::max<std::size_t>(1, count / numa_node_count());
+    }
+    result.resize_and_overwrite(count, [&](T* data, std::size_t n) {
+        numa_bind(data, n * sizeof(T), policy, chunk_elements * sizeof(T));
+        std::size_t grain = std::max(parallel_detail::grain_for(n), 4096 / sizeof(T) + 1);
+        parallel_detail::for_range(0, n, grain, [&](std::size_t lo, std::size_t hi) {
+            std::fill(data + lo, data + hi, value);
+        });
+        return n;
+    });
+    return result;
+}
+
+#endif //MY_VECTOR_NUMA_PLACEMENT_HPP
@@ -0,0 +1,280 @@
+#ifndef MY_VECTOR_PARALLEL_ALGORITHMS_HPP
+#define MY_VECTOR_PARALLEL_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include "my_vector.hpp"
+#include "work_stealing_pool.hpp"
+
+// Parallel algorithms over random-access ranges, e.g. a my_vector, a my_array
+// or any sub-range of them, executed on work_stealing_pool::global().
+//
+// Ranges are split recursively with fork_join down to a grain size derived
+// from the range length and the number of threads, so every thread gets
+// several chunks and work stealing evens out chunks of uneven cost. Ranges
+// shorter than parallel_min_grain run sequentially on the calling thread.
+// Reduction and scan operations must be associative.
+
+inline constexpr std::size_t parallel_min_grain = 2048;
+
+namespace parallel_detail {
+
+inline std::size_t grain_for(std::size_t n) {
+    std::size_t chunks = work_stealing_pool::global().concurrency() * 8;
+    return std::max(parallel_min_grain, (n + chunks - 1) / chunks);
+}
+
+// Calls body(lo, hi) for disjoint sub-ranges covering [first, last).
+template <typename Body>
+void for_range(std::size_t first, std::size_t last, std::size_t grain, const Body& body) {
+    if (last - first <= grain) {
+        body(first, last);
+        return;
+    }
+    std::size_t middle = first + (last - first) / 2;
+    work_stealing_pool::global().fork_join([&] { for_range(first, middle, grain, body); },
+                                           [&] { for_range(middle, last, grain, body); });
+}
+
+// Reduces the non-empty range [first, first + n).
+template <typename RandomIt, typename T, typename BinaryOp>
+T reduce_range(RandomIt first, std::size_t n, std::size_t grain, const BinaryOp& op) {
+    if (n <= grain) {
+        T result = first[0];
+        for (std::size_t i = 1; i < n; ++i) {
+            result = op(std::move(result), first[i]);
+        }
+        return result;
+    }
+    std::size_t half = n / 2;
+    std::optional<T> left;
+    std::optional<T> right;
+    work_stealing_pool::global().fork_join(
+            [&] { left.emplace(reduce_range<RandomIt, T>(first, half, grain, op)); },
+            [&] { right.emplace(reduce_range<RandomIt, T>(first + half, n - half, grain, op)); });
+    return op(std::move(*left), std::move(*right));
+}
+
+// Splits n elements into blocks for the two-pass algorithms (scan, partition).
+inline std::size_t block_count(std::size_t n) {
+    std::size_t blocks = work_stealing_pool::global().concurrency() * 4;
+    return std::max<std::size_t>(1, std::min(blocks, n / parallel_min_grain));
+}
+
+inline std::size_t block_begin(std::size_t n, std::size_t blocks, std::size_t block) {
+    return n / blocks * block + std::min(block, n % blocks);
+}
+
+} // namespace parallel_detail
+
+template <typename RandomIt, typename UnaryFunction>
+void parallel_for_each(RandomIt first, RandomIt last, UnaryFunction f) {
+    std::size_t n = last - first;
+    parallel_detail::for_range(0, n, parallel_detail::grain_for(n), [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) {
+            f(first[i]);
+        }
+    });
+}
+
+template <typename RandomIt, typename OutputIt, typename UnaryOperation>
+OutputIt parallel_transform(RandomIt first, RandomIt last, OutputIt out, UnaryOperation op) {
+    std::size_t n = last - first;
+    parallel_detail::for_range(0, n, parallel_detail::grain_for(n), [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) {
+            out[i] = op(first[i]);
+        }
+    });
+    return out + n;
+}
+
+template <typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+T parallel_reduce(RandomIt first, RandomIt last, T init, BinaryOp op = BinaryOp()) {
+    std::size_t n = last - first;
+    if (n == 0) return init;
+    return op(std::move(init), parallel_detail::reduce_range<RandomIt, T>(first, n, parallel_detail::grain_for(n), op));
+}
+
+template <typename RandomIt, typename UnaryPredicate>
+std::size_t parallel_count_if(RandomIt first, RandomIt last, UnaryPredicate pred) {
+    std::size_t n = last - first;
+    std::atomic<std::size_t> total{0};
+    parallel_detail::for_range(0, n, parallel_detail::grain_for(n), [&](std::size_t lo, std::size_t hi) {
+        std::size_t count = 0;
+        for (std::size_t i = lo; i < hi; ++i) {
+            count += pred(first[i]) ? 1 : 0;
+        }
+        total.fetch_add(count, std::memory_order_relaxed);
+    });
+    return total.load();
+}
+
+// out[i] = first[0] op ... op first[i]. The input and output may be the same range.
+template <typename RandomIt, typename OutputIt, typename BinaryOp = std::plus<>>
+OutputIt parallel_inclusive_scan(RandomIt first, RandomIt last, OutputIt out, BinaryOp op = BinaryOp()) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    std::size_t n = last - first;
+    if (n == 0) return out;
+
+    std::size_t blocks = parallel_detail::block_count(n);
+    my_vector<std::optional<T>> carry(blocks);
+    parallel_detail::for_range(0, blocks - 1, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            std::size_t begin = parallel_detail::block_begin(n, blocks, b);
+            std::size_t end = parallel_detail::block_begin(n, blocks, b + 1);
+            carry[b + 1].emplace(parallel_detail::reduce_range<RandomIt, T>(first + begin, end - begin, end - begin, op));
+        }
+    });
+    for (std::size_t b = 2; b < blocks; ++b) {
+        carry[b] = op(*carry[b - 1], *carry[b]);
+    }
+
+    parallel_detail::for_range(0, blocks, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            std::size_t begin = parallel_detail::block_begin(n, blocks, b);
+            std::size_t end = parallel_detail::block_begin(n, blocks, b + 1);
+            T acc = carry[b] ? op(*carry[b], first[begin]) : T(first[begin]);
+            out[begin] = acc;
+            for (std::size_t i = begin + 1; i < end; ++i) {
+                acc = op(std::move(acc), first[i]);
+                out[i] = acc;
+            }
+        }
+    });
+    return out + n;
+}
+
+// out[i] = init op first[0] op ... op first[i - 1]. The input and output may
+// be the same range.
+template <typename RandomIt, typename OutputIt, typename T, typename BinaryOp = std::plus<>>
+OutputIt parallel_exclusive_scan(RandomIt first, RandomIt last, OutputIt out, T init, BinaryOp op = BinaryOp()) {
+    std::size_t n = last - first;
+    if (n == 0) return out;
+
+    std::size_t blocks = parallel_detail::block_count(n);
+    my_vector<std::optional<T>> carry(blocks);
+    carry[0].emplace(std::move(init));
+    parallel_detail::for_range(0, blocks - 1, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            std::size_t begin = parallel_detail::block_begin(n, blocks, b);
+            std::size_t end = parallel_detail::block_begin(n, blocks, b + 1);
+            carry[b + 1].emplace(parallel_detail::reduce_range<RandomIt, T>(first + begin, end - begin, end - begin, op));
+        }
+    });
+    for (std::size_t b = 1; b < blocks; ++b) {
+        carry[b] = op(*carry[b - 1], *carry[b]);
+    }
+
+    parallel_detail::for_range(0, blocks, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            std::size_t begin = parallel_detail::block_begin(n, blocks, b);
+            std::size_t end = parallel_detail::block_begin(n, blocks, b + 1);
+            T acc = *carry[b];
+            for (std::size_t i = begin; i < end; ++i) {
+                T next = op(acc, first[i]);
+                out[i] = std::move(acc);
+                acc = std::move(next);
+            }
+        }
+    });
+    return out + n;
+}
+
+// Stable partition: elements satisfying pred keep their relative order and
+// come first, followed by the rest in their original order. Elements are
+// moved through a temporary my_vector, so T must be default-constructible.
+template <typename RandomIt, typename UnaryPredicate>
+RandomIt parallel_partition(RandomIt first, RandomIt last, UnaryPredicate pred) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    std::size_t n = last - first;
+    if (n == 0) return first;
+
+    std::size_t blocks = parallel_detail::block_count(n);
+    my_vector<std::size_t> selected(blocks + 1, 0);
+    parallel_detail::for_range(0, blocks, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            std::size_t count = 0;
+            std::size_t end = parallel_detail::block_begin(n, blocks, b + 1);
+            for (std::size_t i = parallel_detail::block_begin(n, blocks, b); i < end; ++i) {
+                count += pred(first[i]) ? 1 : 0;
+            }
+            selected[b + 1] = count;
+        }
+    });
+    for (std::size_t b = 1; b <= blocks; ++b) {
+        selected[b] += selected[b - 1];
+    }
+    const std::size_t total_selected = selected[blocks];
+
+    my_vector<T> buffer(n);
+    parallel_detail::for_range(0, blocks, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            std::size_t begin = parallel_detail::block_begin(n, blocks, b);
+            std::size_t end = parallel_detail::block_begin(n, blocks, b + 1);
+            std::size_t yes = selected[b];
+            std::size_t no = total_selected + (begin - selected[b]);
+            for (std::size_t i = begin; i < end; ++i) {
+                // Re-evaluating pred is cheaper than keeping a flag per element.
+                buffer[pred(first[i]) ? yes++ : no++] = std::move(first[i]);
+            }
+        }
+    });
+    parallel_detail::for_range(0, n, parallel_detail::grain_for(n), [&](std::size_t lo, std::size_t hi) {
+        std::move(buffer.begin() + lo, buffer.begin() + hi, first + lo);
+    });
+    return first + total_selected;
+}
+
+// Whole-container overloads for my_vector, my_array and similar containers.
+// They are constrained so that calls with iterators never pick them.
+
+namespace parallel_detail {
+
+template <typename Container>
+concept iterable = requires(Container& c) {
+    c.begin();
+    c.end();
+};
+}
+
+template <parallel_detail::iterable Container, typename UnaryFunction>
+void parallel_for_each(Container& c, UnaryFunction f) {
+    parallel_for_each(c.begin(), c.end(), std::move(f));
+}
+
+template <parallel_detail::iterable Container, typename OutputIt, typename UnaryOperation>
+OutputIt parallel_transform(const Container& c, OutputIt out, UnaryOperation op) {
+    return parallel_transform(c.begin(), c.end(), out, std::move(op));
+}
+
+template <parallel_detail::iterable Container, typename T, typename BinaryOp = std::plus<>>
+T parallel_reduce(const Container& c, T init, BinaryOp op = BinaryOp()) {
+    return parallel_reduce(c.begin(), c.end(), std::move(init), std::move(op));
+}
+
+template <parallel_detail::iterable Container, typename UnaryPredicate>
+std::size_t parallel_count_if(const Container& c, UnaryPredicate pred) {
+    return parallel_count_if(c.begin(), c.end(), std::move(pred));
+}
+
+template <parallel_detail::iterable Container, typename OutputIt, typename BinaryOp = std::plus<>>
+OutputIt parallel_inclusive_scan(const Container& c, OutputIt out, BinaryOp op = BinaryOp()) {
+    return parallel_inclusive_scan(c.begin(), c.end(), out, std::move(op));
+}
+
+template <parallel_detail::iterable Container, typename OutputIt, typename T, typename BinaryOp = std::plus<>>
+OutputIt parallel_exclusive_scan(const Container& c, OutputIt out, T init, BinaryOp op = BinaryOp()) {
+    return parallel_exclusive_scan(c.begin(), c.end(), out, std::move(init), std::move(op));
+}
+
+template <parallel_detail::iterable Container, typename UnaryPredicate>
+auto parallel_partition(Container& c, UnaryPredicate pred) {
+    return parallel_partition(c.begin(), c.end(), std::move(pred));
+}
+
+#endif //MY_VECTOR_PARALLEL_ALGORITHMS_HPP
@@ -0,0 +1,81 @@
+#ifndef MY_VECTOR_PERF_COUNTERS_HPP
+#define MY_VECTOR_PERF_COUNTERS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Hardware and software event counters for a region of code.
+//
+// On Linux the counters are opened with perf_event_open for the calling
+// thread. Every event is opened on its own, so a kernel or VM that lacks, say,
+// the cache-miss event still reports the others. When page faults cannot be
+// counted by perf they are taken from getrusage instead. Events the kernel
+// had to multiplex are scaled by the fraction of time they were counting, and
+// an event that never got a counter is reported as not valid. On other
+// platforms, or when perf events are disabled entirely, only wall time is
+// measured.
+class perf_counters {
+public:
+    enum event : std::size_t {
+        cycles,
+        instructions,
+        cache_misses,
+        branch_misses,
+        page_faults,
+        event_count
+    };
+
+    struct sample {
+        double wall_ns = 0;
+        std::uint64_t values[event_count] = {};
+        bool valid[event_count] = {};
+    };
+
+    // With open_events false no perf events are opened, as if perf were
+    // unavailable.
+    explicit perf_counters(bool open_events = true);
+    ~perf_counters();
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    void start();
+    sample stop();
+
+    [[nodiscard]] bool available(event e) const noexcept;
+
+    static const char* event_name(event e) noexcept;
+
+private:
+    int fds_[event_count];
+    long rusage_faults_ = 0;
+    std::chrono::steady_clock::time_point started_;
+};
+
+// Keeps the optimizer from discarding the work that produced value.
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static_cast<void>(value);
+#endif
+}
+
+// Prints the sample with every counter divided by ops.
+void print_sample(const std::string& name, std::size_t ops, const perf_counters::sample& result);
+
+// Runs f once under the counters and prints the totals divided by ops.
+template <typename F>
+perf_counters::sample measure(const std::string& name, std::size_t ops, F&& f) {
+    perf_counters counters;
+    counters.start();
+    f();
+    perf_counters::sample result = counters.stop();
+    print_sample(name, ops, result);
+    return result;
+}
+
+#endif //MY_VECTOR_PERF_COUNTERS_HPP
@@ -0,0 +1,869 @@
+#ifndef MY_VECTOR_PERSISTENT_VECTOR_HPP
+#define MY_VECTOR_PERSISTENT_VECTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "inplace_vector.hpp"
+#include "my_vector.hpp"
+
+template <typename T>
+class transient_vector;
+
+// Immutable vector with structural sharing: a relaxed radix balanced tree
+// (RRB tree) with 32-way nodes.
+//
+// Every modification returns a new vector and leaves the original intact.
+// Only the O(log32 N) nodes on the path to the change are copied; the rest
+// is shared with the original, so keeping many versions costs memory in
+// proportion to the changes. The last (up to 32) elements live in a separate
+// tail leaf, which makes push_back amortized O(1).
+//
+// Nodes whose subtrees are densely packed are indexed by radix arithmetic.
+// slice() and concat() can leave partly filled nodes in the middle of the
+// tree; such "relaxed" nodes keep a table of cumulative subtree sizes that
+// lookups scan from the radix guess. concat() merges the two trees along the
+// seam and redistributes the nodes there, keeping each level within two
+// nodes of the minimum, so the depth stays O(log32 N).
+//
+// Nodes are reference-counted with std::shared_ptr, so versions can be
+// shared between threads. Batches of changes are cheaper through
+// transient(): a transient_vector edits the nodes it has already copied in
+// place.
+template <typename T>
+class persistent_vector {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = const T&;
+
+    static constexpr unsigned bits = 5;
+    static constexpr size_type branching = size_type(1) << bits;
+
+private:
+    friend class transient_vector<T>;
+
+    struct node_base {
+        // Transient that may edit the node in place; 0 means none.
+        std::uint64_t owner = 0;
+    };
+
+    using node_ptr = std::shared_ptr<node_base>;
+
+    struct leaf_node : node_base {
+        inplace_vector<T, branching> values;
+    };
+
+    struct inner_node : node_base {
+        inplace_vector<node_ptr, branching> children;
+        // Cumulative element counts of the children; empty when dense.
+        inplace_vector<size_type, branching> sizes;
+    };
+
+    // Leaves are at height 0; root_ is null when all elements are in tail_.
+    node_ptr root_;
+    unsigned height_ = 0;
+    std::shared_ptr<leaf_node> tail_;
+    size_type size_ = 0;
+
+    static leaf_node* as_leaf(const node_ptr& n) noexcept {
+        return static_cast<leaf_node*>(n.get());
+    }
+
+    static inner_node* as_inner(const node_ptr& n) noexcept {
+        return static_cast<inner_node*>(n.get());
+    }
+
+    static std::uint64_t next_owner() noexcept {
+        static std::atomic<std::uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // Element count of a full subtree of the given height.
+    static size_type full_size(unsigned height) noexcept {
+        unsigned shift = bits * (height + 1);
+        return shift >= 64 ? ~size_type(0) : size_type(1) << shift;
+    }
+
+    static size_type slot_count(const node_ptr& n, unsigned height) noexcept {
+        return height == 0 ? as_leaf(n)->values.size() : as_inner(n)->children.size();
+    }
+
+    static size_type tree_size(const node_ptr& n, unsigned height) noexcept {
+        if (height == 0) return as_leaf(n)->values.size();
+        inner_node* inner = as_inner(n);
+        if (!inner->sizes.empty()) return inner->sizes.back();
+        return (inner->children.size() - 1) * full_size(height - 1) + tree_size(inner->children.back(), height - 1);
+    }
+
+    static bool is_dense(const node_ptr& n, unsigned height) noexcept {
+        return height == 0 || as_inner(n)->sizes.empty();
+    }
+
+    // Fills in the size table of a node that is no longer dense.
+    static void make_relaxed(inner_node* inner, unsigned height) {
+        if (!inner->sizes.empty()) return;
+        size_type total = 0;
+        for (const node_ptr& child : inner->children) {
+            total += tree_size(child, height - 1);
+            inner->sizes.push_back(total);
+        }
+    }
+
+    template <typename Children>
+    static node_ptr make_inner(const Children& children, unsigned height, std::uint64_t owner = 0) {
+        auto inner = std::make_shared<inner_node>();
+        inner->owner = owner;
+        bool dense = true;
+        for (size_type i = 0; i < children.size(); ++i) {
+            inner->children.push_back(children[i]);
+            bool last = i + 1 == children.size();
+            dense = dense && (last ? is_dense(children[i], height - 1)
+                                   : tree_size(children[i], height - 1) == full_size(height - 1));
+        }
+        if (!dense) {
+            make_relaxed(inner.get(), height);
+        }
+        return inner;
+    }
+
+    // Returns n itself if the transient owner may edit it, else a copy that
+    // owner may edit.
+    template <typename Node>
+    static std::shared_ptr<Node> editable(const node_ptr& n, std::uint64_t owner) {
+        if (owner != 0 && n->owner == owner) {
+            return std::static_pointer_cast<Node>(n);
+        }
+        auto copy = std::make_shared<Node>(*static_cast<const Node*>(n.get()));
+        copy->owner = owner;
+        return copy;
+    }
+
+    // Finds the child holding element index and makes index relative to it.
+    static size_type child_for(const inner_node* inner, unsigned height, size_type& index) noexcept {
+        unsigned shift = bits * height;
+        if (inner->sizes.empty()) {
+            size_type c = (index >> shift) & (branching - 1);
+            index &= (size_type(1) << shift) - 1;
+            return c;
+        }
+        size_type c = index >> shift;
+        while (inner->sizes[c] <= index) {
+            ++c;
+        }
+        if (c > 0) {
+            index -= inner->sizes[c - 1];
+        }
+        return c;
+    }
+
+    size_type tail_offset() const noexcept {
+        return size_ - (tail_ ? tail_->values.size() : 0);
+    }
+
+    // Leaf holding element index; index becomes the position in the leaf.
+    const leaf_node* leaf_for(size_type& index) const noexcept {
+        size_type offset = tail_offset();
+        if (index >= offset) {
+            index -= offset;
+            return tail_.get();
+        }
+        const node_ptr* n = &root_;
+        for (unsigned h = height_; h > 0; --h) {
+            const inner_node* inner = as_inner(*n);
+            n = &inner->children[child_for(inner, h, index)];
+        }
+        return as_leaf(*n);
+    }
+
+    // Wraps a leaf in single-child nodes up to the given height.
+    static node_ptr path_to(node_ptr leaf, unsigned height, std::uint64_t owner) {
+        for (unsigned h = 1; h <= height; ++h) {
+            auto inner = std::make_shared<inner_node>();
+            inner->owner = owner;
+            inner->children.push_back(std::move(leaf));
+            leaf = std::move(inner);
+        }
+        return leaf;
+    }
+
+    // Appends a leaf at the right edge of the subtree; null if it is full.
+    static node_ptr push_leaf(const node_ptr& n, unsigned height, const node_ptr& leaf, std::uint64_t owner) {
+        if (height == 0) return nullptr;
+        const inner_node* inner = as_inner(n);
+        size_type leaf_size = as_leaf(leaf)->values.size();
+
+        if (height > 1) {
+            node_ptr child = push_leaf(inner->children.back(), height - 1, leaf, owner);
+            if (child) {
+                auto copy = editable<inner_node>(n, owner);
+                copy->children.back() = std::move(child);
+                if (!copy->sizes.empty()) {
+                    copy->sizes.back() += leaf_size;
+                } else if (!is_dense(copy->children.back(), height - 1)) {
+                    make_relaxed(copy.get(), height);
+                }
+                return copy;
+            }
+        }
+        if (inner->children.size() == branching) return nullptr;
+
+        auto copy = editable<inner_node>(n, owner);
+        if (copy->sizes.empty() && tree_size(copy->children.back(), height - 1) != full_size(height - 1)) {
+            make_relaxed(copy.get(), height);
+        }
+        copy->children.push_back(path_to(leaf, height - 1, owner));
+        if (!copy->sizes.empty()) {
+            copy->sizes.push_back(copy->sizes.back() + leaf_size);
+        }
+        return copy;
+    }
+
+    void push_tail_into_tree(std::uint64_t owner) {
+        node_ptr leaf = std::move(tail_);
+        tail_.reset();
+        if (!root_) {
+            root_ = std::move(leaf);
+            height_ = 0;
+            return;
+        }
+        node_ptr pushed = push_leaf(root_, height_, leaf, owner);
+        if (pushed) {
+            root_ = std::move(pushed);
+            return;
+        }
+        node_ptr children[] = {root_, path_to(leaf, height_, owner)};
+        root_ = make_inner(my_vector<node_ptr>(std::begin(children), std::end(children)), height_ + 1, owner);
+        ++height_;
+    }
+
+    template <typename... Args>
+    void emplace_back_owned(std::uint64_t owner, Args&&... args) {
+        if (tail_ && tail_->values.size() == branching) {
+            push_tail_into_tree(owner);
+        }
+        if (!tail_) {
+            tail_ = std::make_shared<leaf_node>();
+            tail_->owner = owner;
+        } else {
+            tail_ = editable<leaf_node>(tail_, owner);
+        }
+        tail_->values.emplace_back(std::forward<Args>(args)...);
+        ++size_;
+    }
+
+    static node_ptr set_in(const node_ptr& n, unsigned height, size_type index, const T& value,
+                           std::uint64_t owner) {
+        if (height == 0) {
+            auto leaf = editable<leaf_node>(n, owner);
+            leaf->values[index] = value;
+            return leaf;
+        }
+        auto inner = editable<inner_node>(n, owner);
+        size_type c = child_for(inner.get(), height, index);
+        inner->children[c] = set_in(inner->children[c], height - 1, index, value, owner);
+        return inner;
+    }
+
+    void set_owned(size_type index, const T& value, std::uint64_t owner) {
+        size_type offset = tail_offset();
+        if (index >= offset) {
+            tail_ = editable<leaf_node>(tail_, owner);
+            tail_->values[index - offset] = value;
+        } else {
+            root_ = set_in(root_, height_, index, value, owner);
+        }
+    }
+
+    void collapse_root() {
+        while (height_ > 0 && as_inner(root_)->children.size() == 1) {
+            node_ptr child = as_inner(root_)->children[0];
+            root_ = std::move(child);
+            --height_;
+        }
+    }
+
+    // Keeps the first count elements of the subtree; count must end on a
+    // leaf boundary.
+    static node_ptr take_tree(const node_ptr& n, unsigned height, size_type count) {
+        if (height == 0) return n;
+        const inner_node* inner = as_inner(n);
+        size_type last = count - 1;
+        size_type c = child_for(inner, height, last);
+        auto copy = std::make_shared<inner_node>();
+        for (size_type i = 0; i < c; ++i) {
+            copy->children.push_back(inner->children[i]);
+        }
+        copy->children.push_back(take_tree(inner->children[c], height - 1, last + 1));
+        if (!inner->sizes.empty()) {
+            for (size_type i = 0; i < c; ++i) {
+                copy->sizes.push_back(inner->sizes[i]);
+            }
+            copy->sizes.push_back(count);
+        }
+        return copy;
+    }
+
+    // Removes the first count elements of the subtree.
+    static node_ptr drop_tree(const node_ptr& n, unsigned height, size_type count) {
+        if (height == 0) {
+            auto leaf = std::make_shared<leaf_node>();
+            const auto& values = as_leaf(n)->values;
+            leaf->values.assign(values.begin() + count, values.end());
+            return leaf;
+        }
+        const inner_node* inner = as_inner(n);
+        size_type c = child_for(inner, height, count);
+        my_vector<node_ptr> children;
+        children.push_back(count == 0 ? inner->children[c] : drop_tree(inner->children[c], height - 1, count));
+        for (size_type i = c + 1; i < inner->children.size(); ++i) {
+            children.push_back(inner->children[i]);
+        }
+        return make_inner(children, height);
+    }
+
+    // Redistributes the slots of nodes of one height so that there are at
+    // most two nodes more than the minimum. Nodes that keep their contents
+    // are reused.
+    static my_vector<node_ptr> rebalance(const my_vector<node_ptr>& nodes, unsigned height) {
+        constexpr size_type extra = 2;
+        my_vector<size_type> counts;
+        size_type total = 0;
+        for (const node_ptr& n : nodes) {
+            counts.push_back(slot_count(n, height));
+            total += counts.back();
+        }
+        size_type optimal = (total + branching - 1) / branching;
+        size_type n = counts.size();
+        if (n <= optimal + extra) return nodes;
+
+        // Each round empties the first node that is not nearly full into
+        // the nodes after it.
+        size_type i = 0;
+        while (n > optimal + extra) {
+            while (counts[i] > branching - extra / 2) {
+                ++i;
+            }
+            size_type remaining = counts[i];
+            do {
+                size_type filled = std::min(remaining + counts[i + 1], branching);
+                remaining = remaining + counts[i + 1] - filled;
+                counts[i] = filled;
+                ++i;
+            } while (remaining > 0);
+            for (size_type j = i; j + 1 < n; ++j) {
+                counts[j] = counts[j + 1];
+            }
+            --n;
+            --i;
+        }
+
+        my_vector<node_ptr> result;
+        size_type source = 0;
+        size_type offset = 0;
+        for (size_type k = 0; k < n; ++k) {
+            if (offset == 0 && slot_count(nodes[source], height) == counts[k]) {
+                result.push_back(nodes[source++]);
+                continue;
+            }
+            if (height == 0) {
+                auto leaf = std::make_shared<leaf_node>();
+                while (leaf->values.size() < counts[k]) {
+                    const auto& values = as_leaf(nodes[source])->values;
+                    size_type take = std::min(counts[k] - leaf->values.size(), values.size() - offset);
+                    leaf->values.insert(leaf->values.end(), values.begin() + offset, values.begin() + offset + take);
+                    offset += take;
+                    if (offset == values.size()) {
+                        ++source;
+                        offset = 0;
+                    }
+                }
+                result.push_back(std::move(leaf));
+            } else {
+                my_vector<node_ptr> children;
+                while (children.size() < counts[k]) {
+                    const auto& from = as_inner(nodes[source])->children;
+                    children.push_back(from[offset++]);
+                    if (offset == from.size()) {
+                        ++source;
+                        offset = 0;
+                    }
+                }
+                result.push_back(make_inner(children, height));
+            }
+        }
+        return result;
+    }
+
+    // Rebalances nodes of the given height and packs them under a node of
+    // height + 2 that has one or two children.
+    static node_ptr join(const my_vector<node_ptr>& nodes, unsigned height) {
+        my_vector<node_ptr> balanced = rebalance(nodes, height);
+        my_vector<node_ptr> groups;
+        for (size_type first = 0; first < balanced.size(); first += branching) {
+            size_type last = std::min(first + branching, balanced.size());
+            groups.push_back(make_inner(my_vector<node_ptr>(balanced.begin() + first, balanced.begin() + last),
+                                        height + 1));
+        }
+        return make_inner(groups, height + 2);
+    }
+
+    // Concatenates two trees into a node of height max(lh, rh) + 1 with one
+    // or two children.
+    static node_ptr concat_trees(const node_ptr& left, unsigned lh, const node_ptr& right, unsigned rh) {
+        my_vector<node_ptr> nodes;
+        if (lh > rh) {
+            const inner_node* l = as_inner(left);
+            node_ptr middle = concat_trees(l->children.back(), lh - 1, right, rh);
+            nodes.insert(nodes.end(), l->children.begin(), l->children.end() - 1);
+            const auto& mid = as_inner(middle)->children;
+            nodes.insert(nodes.end(), mid.begin(), mid.end());
+            return join(nodes, lh - 1);
+        }
+        if (lh < rh) {
+            const inner_node* r = as_inner(right);
+            node_ptr middle = concat_trees(left, lh, r->children.front(), rh - 1);
+            const auto& mid = as_inner(middle)->children;
+            nodes.insert(nodes.end(), mid.begin(), mid.end());
+            nodes.insert(nodes.end(), r->children.begin() + 1, r->children.end());
+            return join(nodes, rh - 1);
+        }
+        if (lh == 0) {
+            nodes.push_back(left);
+            nodes.push_back(right);
+            return make_inner(rebalance(nodes, 0), 1);
+        }
+        const inner_node* l = as_inner(left);
+        const inner_node* r = as_inner(right);
+        node_ptr middle = concat_trees(l->children.back(), lh - 1, r->children.front(), rh - 1);
+        nodes.insert(nodes.end(), l->children.begin(), l->children.end() - 1);
+        const auto& mid = as_inner(middle)->children;
+        nodes.insert(nodes.end(), mid.begin(), mid.end());
+        nodes.insert(nodes.end(), r->children.begin() + 1, r->children.end());
+        return join(nodes, lh - 1);
+    }
+
+    template <typename F>
+    static void for_each_in(const node_ptr& n, unsigned height, F& f) {
+        if (height == 0) {
+            for (const T& value : as_leaf(n)->values) {
+                f(value);
+            }
+            return;
+        }
+        for (const node_ptr& child : as_inner(n)->children) {
+            for_each_in(child, height - 1, f);
+        }
+    }
+
+    // Builds dense levels bottom-up from full leaves.
+    template <typename InputIt>
+    void build(InputIt first, InputIt last) {
+        my_vector<node_ptr> level;
+        while (first != last) {
+            auto leaf = std::make_shared<leaf_node>();
+            for (; first != last && leaf->values.size() < branching; ++first) {
+                leaf->values.push_back(*first);
+            }
+            size_ += leaf->values.size();
+            if (tail_) {
+                level.push_back(std::move(tail_));
+            }
+            tail_ = std::move(leaf);
+        }
+        if (level.empty()) return;
+
+        unsigned height = 0;
+        while (level.size() > 1) {
+            my_vector<node_ptr> parents;
+            for (size_type i = 0; i < level.size(); i += branching) {
+                size_type end = std::min(i + branching, level.size());
+                parents.push_back(make_inner(my_vector<node_ptr>(level.begin() + i, level.begin() + end), height + 1));
+            }
+            level.swap(parents);
+            ++height;
+        }
+        root_ = level[0];
+        height_ = height;
+    }
+
+public:
+    // Random-access iterator that remembers the leaf it is in, so stepping
+    // through a leaf does not walk the tree.
+    class const_iterator {
+        friend class persistent_vector;
+
+        const persistent_vector* vector_ = nullptr;
+        size_type index_ = 0;
+        mutable const T* leaf_ = nullptr;
+        mutable size_type leaf_begin_ = 0;
+        mutable size_type leaf_end_ = 0;
+
+        const_iterator(const persistent_vector* vector, size_type index) noexcept : vector_(vector), index_(index) {}
+
+        const T& load() const noexcept {
+            if (index_ < leaf_begin_ || index_ >= leaf_end_) {
+                size_type offset = index_;
+                const leaf_node* leaf = vector_->leaf_for(offset);
+                leaf_ = leaf->values.data();
+                leaf_begin_ = index_ - offset;
+                leaf_end_ = leaf_begin_ + leaf->values.size();
+            }
+            return leaf_[index_ - leaf_begin_];
+        }
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+
+        reference operator*() const noexcept {
+            return load();
+        }
+
+        pointer operator->() const noexcept {
+            return &load();
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *(*this + n);
+        }
+
+        const_iterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept {
+            const_iterator tmp = *this;
+            ++index_;
+            return tmp;
+        }
+
+        const_iterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept {
+            const_iterator tmp = *this;
+            --index_;
+            return tmp;
+        }
+
+        const_iterator& operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        const_iterator& operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend const_iterator operator+(const_iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend const_iterator operator+(difference_type n, const_iterator it) noexcept {
+            return it += n;
+        }
+
+        friend const_iterator operator-(const_iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend auto operator<=>(const const_iterator& lhs, const const_iterator& rhs) noexcept {
+            return lhs.index_ <=> rhs.index_;
+        }
+    };
+
+    using iterator = const_iterator;
+
+    persistent_vector() noexcept = default;
+
+    template <typename InputIt, typename = std::enable_if_t<std::is_base_of_v<
+            std::input_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>>>
+    persistent_vector(InputIt first, InputIt last) {
+        build(first, last);
+    }
+
+    persistent_vector(std::initializer_list<T> init) : persistent_vector(init.begin(), init.end()) {}
+
+    explicit persistent_vector(const my_vector<T>& values) : persistent_vector(values.begin(), values.end()) {}
+
+    const_reference operator[](size_type pos) const noexcept {
+        const leaf_node* leaf = leaf_for(pos);
+        return leaf->values[pos];
+    }
+
+    const_reference at(size_type pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("persistent_vector::at");
+        }
+        return (*this)[pos];
+    }
+
+    const_reference front() const noexcept {
+        return (*this)[0];
+    }
+
+    const_reference back() const noexcept {
+        return tail_->values.back();
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    // Height of the tree without the tail, for tests and diagnostics.
+    [[nodiscard]] unsigned depth() const noexcept {
+        return root_ ? height_ + 1 : 0;
+    }
+
+    [[nodiscard]] persistent_vector set(size_type pos, const T& value) const {
+        if (pos >= size_) {
+            throw std::out_of_range("persistent_vector::set");
+        }
+        persistent_vector result(*this);
+        result.set_owned(pos, value, 0);
+        return result;
+    }
+
+    [[nodiscard]] persistent_vector push_back(const T& value) const {
+        persistent_vector result(*this);
+        result.emplace_back_owned(0, value);
+        return result;
+    }
+
+    [[nodiscard]] persistent_vector pop_back() const {
+        return take(size_ == 0 ? 0 : size_ - 1);
+    }
+
+    // The first count elements.
+    [[nodiscard]] persistent_vector take(size_type count) const {
+        if (count >= size_) return *this;
+        if (count == 0) return persistent_vector();
+
+        persistent_vector result;
+        result.size_ = count;
+        size_type offset = tail_offset();
+        if (count > offset) {
+            result.root_ = root_;
+            result.height_ = height_;
+            result.tail_ = std::make_shared<leaf_node>();
+            result.tail_->values.assign(tail_->values.begin(), tail_->values.begin() + (count - offset));
+            return result;
+        }
+
+        // The leaf with the new last element becomes the tail.
+        size_type last = count - 1;
+        const leaf_node* leaf = leaf_for(last);
+        result.tail_ = std::make_shared<leaf_node>();
+        result.tail_->values.assign(leaf->values.begin(), leaf->values.begin() + last + 1);
+        size_type tree_count = count - (last + 1);
+        if (tree_count > 0) {
+            result.root_ = take_tree(root_, height_, tree_count);
+            result.height_ = height_;
+            result.collapse_root();
+        }
+        return result;
+    }
+
+    // All but the first count elements.
+    [[nodiscard]] persistent_vector drop(size_type count) const {
+        if (count == 0) return *this;
+        if (count >= size_) return persistent_vector();
+
+        persistent_vector result;
+        result.size_ = size_ - count;
+        size_type offset = tail_offset();
+        if (count >= offset) {
+            result.tail_ = std::make_shared<leaf_node>();
+            result.tail_->values.assign(tail_->values.begin() + (count - offset), tail_->values.end());
+            return result;
+        }
+        result.root_ = drop_tree(root_, height_, count);
+        result.height_ = height_;
+        result.tail_ = tail_;
+        result.collapse_root();
+        return result;
+    }
+
+    // Elements [first, last).
+    [[nodiscard]] persistent_vector slice(size_type first, size_type last) const {
+        if (first > last || last > size_) {
+            throw std::out_of_range("persistent_vector::slice");
+        }
+        return take(last).drop(first);
+    }
+
+    // This vector followed by other, in O(log32 N) node operations.
+    [[nodiscard]] persistent_vector concat(const persistent_vector& other) const {
+        if (other.empty()) return *this;
+        if (empty()) return other;
+        if (!other.root_) {
+            // Only a tail to append.
+            transient_vector<T> result = transient();
+            for (const T& value : other.tail_->values) {
+                result.push_back(value);
+            }
+            return result.persistent();
+        }
+
+        persistent_vector result(*this);
+        result.push_tail_into_tree(0);
+        node_ptr merged = concat_trees(result.root_, result.height_, other.root_, other.height_);
+        result.root_ = std::move(merged);
+        result.height_ = std::max(result.height_, other.height_) + 1;
+        result.collapse_root();
+        result.tail_ = other.tail_;
+        result.size_ = size_ + other.size_;
+        return result;
+    }
+
+    [[nodiscard]] transient_vector<T> transient() const {
+        return transient_vector<T>(*this);
+    }
+
+    template <typename F>
+    void for_each(F f) const {
+        if (root_) {
+            for_each_in(root_, height_, f);
+        }
+        if (tail_) {
+            for (const T& value : tail_->values) {
+                f(value);
+            }
+        }
+    }
+
+    my_vector<T> to_vector() const {
+        my_vector<T> result;
+        result.reserve(size_);
+        for_each([&result](const T& value) { result.push_back(value); });
+        return result;
+    }
+
+    bool operator==(const persistent_vector& other) const {
+        return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+    }
+
+    bool operator!=(const persistent_vector& other) const {
+        return !(*this == other);
+    }
+};
+
+// Mutable view of a persistent_vector for batches of changes. Nodes copied by
+// the transient are owned by it and edited in place afterwards, so a batch of
+// N changes copies each touched node once instead of N times. persistent()
+// returns the result; later changes to the transient copy nodes again and
+// never affect vectors returned before. A transient is move-only, since a copy
+// would edit the nodes it shares with the original in place.
+template <typename T>
+class transient_vector {
+    persistent_vector<T> data_;
+    std::uint64_t owner_;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    explicit transient_vector(persistent_vector<T> from = persistent_vector<T>())
+            : data_(std::move(from)), owner_(persistent_vector<T>::next_owner()) {}
+
+    transient_vector(const transient_vector&) = delete;
+    transient_vector& operator=(const transient_vector&) = delete;
+
+    // The moved-from transient is left empty, under an owner of its own.
+    transient_vector(transient_vector&& other) noexcept
+            : data_(std::exchange(other.data_, persistent_vector<T>())),
+              owner_(std::exchange(other.owner_, persistent_vector<T>::next_owner())) {}
+
+    transient_vector& operator=(transient_vector&& other) noexcept {
+        if (this != &other) {
+            data_ = std::exchange(other.data_, persistent_vector<T>());
+            owner_ = std::exchange(other.owner_, persistent_vector<T>::next_owner());
+        }
+        return *this;
+    }
+
+    const T& operator[](size_type pos) const noexcept {
+        return data_[pos];
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return data_.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    void push_back(const T& value) {
+        data_.emplace_back_owned(owner_, value);
+    }
+
+    void push_back(T&& value) {
+        data_.emplace_back_owned(owner_, std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        data_.emplace_back_owned(owner_, std::forward<Args>(args)...);
+    }
+
+    void set(size_type pos, const T& value) {
+        if (pos >= data_.size()) {
+            throw std::out_of_range("transient_vector::set");
+        }
+        data_.set_owned(pos, value, owner_);
+    }
+
+    persistent_vector<T> persistent() {
+        owner_ = persistent_vector<T>::next_owner();
+        return data_;
+    }
+};
+
+#endif //MY_VECTOR_PERSISTENT_VECTOR_HPP
@@ -0,0 +1,147 @@
+#ifndef MY_VECTOR_RADIX_SORT_HPP
+#define MY_VECTOR_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "my_vector.hpp"
+#include "parallel_algorithms.hpp"
+
+// Parallel LSD radix sort for my_vector.
+//
+// Keys are integers or floating-point numbers, either the elements themselves
+// or extracted from each element by a key function. Keys are mapped to
+// unsigned integers that order the same way and sorted 8 bits per pass. Each
+// pass splits the input into blocks, builds per-block histograms in parallel,
+// turns them into per-block output offsets and scatters the blocks in
+// parallel; the sort is stable. Passes whose digit is the same for every key
+// are skipped, so small keys in wide types cost fewer passes. Elements are
+// moved between the vector and a scratch buffer, which is the vector's own
+// spare capacity when it has room for a second copy of the data. Inputs
+// shorter than radix_sort_threshold are sorted with std::sort/stable_sort.
+//
+// Elements must be trivially copyable.
+
+inline constexpr std::size_t radix_sort_threshold = 4096;
+
+namespace radix_detail {
+
+// Maps a key to an unsigned integer with the same ordering.
+template <typename K>
+auto ordered_bits(K key) noexcept {
+    static_assert(std::is_arithmetic_v<K> && !std::is_same_v<K, bool>, "radix_sort needs integer or floating-point keys");
+    if constexpr (std::is_floating_point_v<K>) {
+        using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        U bits = std::bit_cast<U>(key);
+        // Negative numbers order in reverse, so flip all of their bits.
+        return (bits & sign) ? U(~bits) : U(bits | sign);
+    } else if constexpr (std::is_signed_v<K>) {
+        using U = std::make_unsigned_t<K>;
+        return U(U(key) ^ (U(1) << (sizeof(U) * 8 - 1)));
+    } else {
+        return key;
+    }
+}
+
+constexpr std::size_t radix = 256;
+
+template <typename T, typename KeyFn>
+void sort(T* data, T* scratch, std::size_t n, const KeyFn& key) {
+    using U = decltype(ordered_bits(key(data[0])));
+
+    const std::size_t blocks = parallel_detail::block_count(n);
+    my_vector<std::size_t> counts(blocks * radix);
+    T* src = data;
+    T* dst = scratch;
+
+    for (unsigned shift = 0; shift < sizeof(U) * 8; shift += 8) {
+        auto digit = [&](const T& value) {
+            return static_cast<std::size_t>((ordered_bits(key(value)) >> shift) & (radix - 1));
+        };
+
+        std::fill(counts.begin(), counts.end(), 0);
+        parallel_detail::for_range(0, blocks, 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t b = lo; b < hi; ++b) {
+                std::size_t* histogram = counts.data() + b * radix;
+                std::size_t end = parallel_detail::block_begin(n, blocks, b + 1);
+                for (std::size_t i = parallel_detail::block_begin(n, blocks, b); i < end; ++i) {
+                    ++histogram[digit(src[i])];
+                }
+            }
+        });
+
+        // Digit-major, block-minor prefix sum gives every block its slots.
+        std::size_t running = 0;
+        bool single_digit = false;
+        for (std::size_t d = 0; d < radix; ++d) {
+            std::size_t before = running;
+            for (std::size_t b = 0; b < blocks; ++b) {
+                std::size_t count = counts[b * radix + d];
+                counts[b * radix + d] = running;
+                running += count;
+            }
+            single_digit = single_digit || running - before == n;
+        }
+        if (single_digit) continue;
+
+        parallel_detail::for_range(0, blocks, 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t b = lo; b < hi; ++b) {
+                std::size_t* offsets = counts.data() + b * radix;
+                std::size_t end = parallel_detail::block_begin(n, blocks, b + 1);
+                for (std::size_t i = parallel_detail::block_begin(n, blocks, b); i < end; ++i) {
+                    dst[offsets[digit(src[i])]++] = src[i];
+                }
+            }
+        });
+        std::swap(src, dst);
+    }
+
+    if (src != data) {
+        parallel_detail::for_range(0, n, parallel_detail::grain_for(n), [&](std::size_t lo, std::size_t hi) {
+            std::copy(src + lo, src + hi, data + lo);
+        });
+    }
+}
+
+} // namespace radix_detail
+
+// Stable sort of v by key(element).
+template <typename T, typename KeyFn>
+void radix_sort(my_vector<T>& v, KeyFn key) {
+    static_assert(std::is_trivially_copyable_v<T>, "radix_sort needs trivially copyable elements");
+    const std::size_t n = v.size();
+    if (n < radix_sort_threshold) {
+        std::stable_sort(v.begin(), v.end(), [&](const T& lhs, const T& rhs) {
+            return radix_detail::ordered_bits(key(lhs)) < radix_detail::ordered_bits(key(rhs));
+        });
+        return;
+    }
+
+    if (v.capacity() >= 2 * n) {
+        radix_detail::sort(v.data(), v.data() + n, n, key);
+        return;
+    }
+    my_vector<T> scratch;
+    // The scratch elements are written before they are read.
+    scratch.resize_and_overwrite(n, [](T*, std::size_t count) { return count; });
+    radix_detail::sort(v.data(), scratch.data(), n, key);
+}
+
+// Sorts integers or floating-point numbers in ascending order. Negative zero
+// sorts before positive zero; NaNs with the sign bit clear sort last.
+template <typename T>
+void radix_sort(my_vector<T>& v) {
+    if (v.size() < radix_sort_threshold) {
+        std::sort(v.begin(), v.end(), [](T lhs, T rhs) {
+            return radix_detail::ordered_bits(lhs) < radix_detail::ordered_bits(rhs);
+        });
+        return;
+    }
+    radix_sort(v, [](T value) { return value; });
+}
+
+#endif //MY_VECTOR_RADIX_SORT_HPP
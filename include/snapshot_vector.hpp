@@ -0,0 +1,134 @@
+#ifndef MY_VECTOR_SNAPSHOT_VECTOR_HPP
+#define MY_VECTOR_SNAPSHOT_VECTOR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include "epoch_domain.hpp"
+#include "my_vector.hpp"
+
+// my_vector shared between many readers and occasional writers, in the style
+// of read-copy-update (RCU).
+//
+// Every version of the contents is an immutable my_vector published through
+// an atomic pointer. Readers take a snapshot, which pins the version that was
+// current at that moment for as long as the snapshot lives, without locks or
+// waiting. Writers build a complete new version and publish it; the previous
+// version is freed through epoch_domain::global() once the last snapshot that
+// may see it is gone. Writers are serialized among themselves.
+template <typename T>
+class snapshot_vector {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    using const_iterator = const T*;
+
+private:
+    std::atomic<const my_vector<T>*> current_;
+    std::atomic<std::uint64_t> version_{0};
+    std::mutex writer_mutex_;
+
+    void replace(const my_vector<T>* next) {
+        const my_vector<T>* previous = current_.exchange(next, std::memory_order_seq_cst);
+        version_.fetch_add(1, std::memory_order_release);
+        epoch_domain::global().retire(previous);
+    }
+
+public:
+    // Read access to one version. Snapshots are cheap to take but must be
+    // released on the thread that took them, and should be short-lived:
+    // versions published meanwhile are not freed while one is alive.
+    class snapshot {
+        epoch_domain::read_guard guard_;
+        const my_vector<T>* data_;
+
+    public:
+        explicit snapshot(const snapshot_vector& source)
+                : data_(source.current_.load(std::memory_order_acquire)) {}
+
+        snapshot(const snapshot&) = delete;
+        snapshot& operator=(const snapshot&) = delete;
+
+        const my_vector<T>& operator*() const noexcept {
+            return *data_;
+        }
+
+        const my_vector<T>* operator->() const noexcept {
+            return data_;
+        }
+
+        const_reference operator[](size_type pos) const noexcept {
+            return (*data_)[pos];
+        }
+
+        const_iterator begin() const noexcept {
+            return data_->begin();
+        }
+
+        const_iterator end() const noexcept {
+            return data_->end();
+        }
+
+        [[nodiscard]] size_type size() const noexcept {
+            return data_->size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return data_->empty();
+        }
+    };
+
+    snapshot_vector() : current_(new my_vector<T>()) {}
+
+    explicit snapshot_vector(my_vector<T> initial) : current_(new my_vector<T>(std::move(initial))) {}
+
+    snapshot_vector(const snapshot_vector&) = delete;
+    snapshot_vector& operator=(const snapshot_vector&) = delete;
+
+    // No snapshot may outlive the container.
+    ~snapshot_vector() {
+        delete current_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] snapshot read() const {
+        return snapshot(*this);
+    }
+
+    // Copy of the current version.
+    my_vector<T> copy() const {
+        snapshot s(*this);
+        return *s;
+    }
+
+    // Replaces the contents with next.
+    void publish(my_vector<T> next) {
+        auto* published = new my_vector<T>(std::move(next));
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        replace(published);
+    }
+
+    // Read-copy-update: copies the current version, lets f modify the copy
+    // and publishes it. Concurrent updates are applied one after another.
+    template <typename F>
+    void update(F f) {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        auto* next = new my_vector<T>(*current_.load(std::memory_order_relaxed));
+        try {
+            f(*next);
+        } catch (...) {
+            delete next;
+            throw;
+        }
+        replace(next);
+    }
+
+    // Number of versions published so far.
+    [[nodiscard]] std::uint64_t version() const noexcept {
+        return version_.load(std::memory_order_acquire);
+    }
+};
+
+#endif //MY_VECTOR_SNAPSHOT_VECTOR_HPP
@@ -0,0 +1,17 @@
+#ifndef MY_VECTOR_TESTING_BIT_VECTOR_HPP
+#define MY_VECTOR_TESTING_BIT_VECTOR_HPP
+
+#include <iostream>
+#include <cassert>
+#include "bit_vector.hpp"
+
+void test_bit_vector_push_back();
+void test_bit_vector_proxy_reference();
+void test_bit_vector_resize();
+void test_bit_vector_count();
+void test_bit_vector_find();
+void test_bit_vector_bitwise_operations();
+
+void run_all_bit_vector_tests();
+
+#endif //MY_VECTOR_TESTING_BIT_VECTOR_HPP
@@ -0,0 +1,19 @@
+#ifndef MY_VECTOR_TESTING_CHUNK_PIPELINE_HPP
+#define MY_VECTOR_TESTING_CHUNK_PIPELINE_HPP
+
+#include <iostream>
+#include <cassert>
+#include "chunk_pipeline.hpp"
+
+void test_async_generator();
+void test_chunk_pool_recycling();
+void test_chunk_pipeline_stages();
+void test_chunk_pipeline_buffered();
+void test_chunk_pipeline_backpressure();
+void test_chunk_pipeline_errors();
+void test_chunk_pipeline_consumer_threads();
+void test_chunk_pipeline_early_stop();
+
+void run_all_chunk_pipeline_tests();
+
+#endif //MY_VECTOR_TESTING_CHUNK_PIPELINE_HPP
@@ -0,0 +1,19 @@
+#ifndef MY_VECTOR_TESTING_COMPRESSED_VECTOR_HPP
+#define MY_VECTOR_TESTING_COMPRESSED_VECTOR_HPP
+
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include "compressed_vector.hpp"
+
+void test_compressed_vector_push_back();
+void test_compressed_vector_sorted_ids();
+void test_compressed_vector_unsorted_values();
+void test_compressed_vector_full_width();
+void test_compressed_vector_sequential_decode();
+void test_compressed_vector_iterator();
+void test_compressed_vector_large_append();
+
+void run_all_compressed_vector_tests();
+
+#endif //MY_VECTOR_TESTING_COMPRESSED_VECTOR_HPP
@@ -0,0 +1,16 @@
+#ifndef MY_VECTOR_TESTING_D_ARY_HEAP_HPP
+#define MY_VECTOR_TESTING_D_ARY_HEAP_HPP
+
+#include <iostream>
+#include <cassert>
+#include "d_ary_heap.hpp"
+
+void test_d_ary_heap_push_pop();
+void test_d_ary_heap_arities();
+void test_d_ary_heap_push_range();
+void test_d_ary_heap_decrease_key();
+void test_d_ary_heap_update_and_erase();
+
+void run_all_d_ary_heap_tests();
+
+#endif //MY_VECTOR_TESTING_D_ARY_HEAP_HPP
@@ -0,0 +1,18 @@
+#ifndef MY_VECTOR_TESTING_DECAYING_VECTOR_HPP
+#define MY_VECTOR_TESTING_DECAYING_VECTOR_HPP
+
+#include <iostream>
+#include <cassert>
+#include "decaying_vector.hpp"
+
+void test_decaying_vector_basic_operations();
+void test_decaying_vector_decays_after_burst();
+void test_decaying_vector_keeps_busy_capacity();
+void test_trim_registry_idle_vector();
+void test_trim_registry_concurrent_trim();
+void test_trim_registry_trim_all();
+void test_memory_pressure_watcher();
+
+void run_all_decaying_vector_tests();
+
+#endif //MY_VECTOR_TESTING_DECAYING_VECTOR_HPP
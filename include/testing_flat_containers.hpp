@@ -0,0 +1,20 @@
+#ifndef MY_VECTOR_TESTING_FLAT_CONTAINERS_HPP
+#define MY_VECTOR_TESTING_FLAT_CONTAINERS_HPP
+
+#include <iostream>
+#include <cassert>
+#include "flat_set.hpp"
+#include "flat_map.hpp"
+
+void test_flat_set_insert();
+void test_flat_set_bulk_insert();
+void test_flat_set_erase();
+void test_flat_set_heterogeneous_lookup();
+void test_flat_set_search_index();
+void test_flat_map_access();
+void test_flat_map_bulk_insert();
+void test_flat_map_search_index();
+
+void run_all_flat_container_tests();
+
+#endif //MY_VECTOR_TESTING_FLAT_CONTAINERS_HPP
@@ -0,0 +1,21 @@
+#ifndef MY_VECTOR_TESTING_FLAT_HASH_MAP_HPP
+#define MY_VECTOR_TESTING_FLAT_HASH_MAP_HPP
+
+#include <iostream>
+#include <cassert>
+#include "flat_hash_set.hpp"
+#include "flat_hash_map.hpp"
+
+void test_flat_hash_set_insert();
+void test_flat_hash_set_erase();
+void test_flat_hash_set_rehash();
+void test_flat_hash_map_access();
+void test_flat_hash_map_heterogeneous_lookup();
+void test_flat_hash_map_copy_and_move();
+void test_flat_hash_map_against_std();
+void test_flat_hash_map_aliasing_insert();
+void test_flat_hash_map_rehash_failure();
+
+void run_all_flat_hash_map_tests();
+
+#endif //MY_VECTOR_TESTING_FLAT_HASH_MAP_HPP
@@ -0,0 +1,18 @@
+#ifndef MY_VECTOR_TESTING_GAP_BUFFER_HPP
+#define MY_VECTOR_TESTING_GAP_BUFFER_HPP
+
+#include <iostream>
+#include <cassert>
+#include "gap_buffer.hpp"
+
+void test_gap_buffer_push_and_access();
+void test_gap_buffer_cursor_edits();
+void test_gap_buffer_range_insert_and_erase();
+void test_gap_buffer_contiguous_view();
+void test_gap_buffer_non_trivial_elements();
+void test_gap_buffer_against_my_vector();
+void test_gap_buffer_aliasing_emplace();
+
+void run_all_gap_buffer_tests();
+
+#endif //MY_VECTOR_TESTING_GAP_BUFFER_HPP
@@ -0,0 +1,16 @@
+#ifndef MY_VECTOR_TESTING_INPLACE_VECTOR_HPP
+#define MY_VECTOR_TESTING_INPLACE_VECTOR_HPP
+
+#include <iostream>
+#include <cassert>
+#include "inplace_vector.hpp"
+
+void test_inplace_vector_push_and_access();
+void test_inplace_vector_capacity_limit();
+void test_inplace_vector_insert_and_erase();
+void test_inplace_vector_trivial_copies();
+void test_inplace_vector_element_lifetimes();
+
+void run_all_inplace_vector_tests();
+
+#endif //MY_VECTOR_TESTING_INPLACE_VECTOR_HPP
@@ -0,0 +1,15 @@
+#ifndef MY_VECTOR_TESTING_NUMA_PLACEMENT_HPP
+#define MY_VECTOR_TESTING_NUMA_PLACEMENT_HPP
+
+#include <iostream>
+#include <cassert>
+#include "numa_placement.hpp"
+
+void test_numa_node_count();
+void test_numa_node_list();
+void test_make_numa_vector();
+void test_numa_thread_policy();
+
+void run_all_numa_placement_tests();
+
+#endif //MY_VECTOR_TESTING_NUMA_PLACEMENT_HPP
@@ -0,0 +1,19 @@
+#ifndef MY_VECTOR_TESTING_PARALLEL_ALGORITHMS_HPP
+#define MY_VECTOR_TESTING_PARALLEL_ALGORITHMS_HPP
+
+#include <iostream>
+#include <cassert>
+#include "my_array.hpp"
+#include "parallel_algorithms.hpp"
+
+void test_parallel_for_each();
+void test_parallel_transform();
+void test_parallel_reduce();
+void test_parallel_count_if();
+void test_parallel_scans();
+void test_parallel_partition();
+void test_parallel_exceptions();
+
+void run_all_parallel_algorithm_tests();
+
+#endif //MY_VECTOR_TESTING_PARALLEL_ALGORITHMS_HPP
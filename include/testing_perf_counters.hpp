@@ -0,0 +1,13 @@
+#ifndef MY_VECTOR_TESTING_PERF_COUNTERS_HPP
+#define MY_VECTOR_TESTING_PERF_COUNTERS_HPP
+
+#include <iostream>
+#include <cassert>
+#include "perf_counters.hpp"
+
+void test_perf_counters_measure();
+void test_perf_counters_fallback();
+
+void run_all_perf_counter_tests();
+
+#endif //MY_VECTOR_TESTING_PERF_COUNTERS_HPP
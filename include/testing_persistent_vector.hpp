@@ -0,0 +1,19 @@
+#ifndef MY_VECTOR_TESTING_PERSISTENT_VECTOR_HPP
+#define MY_VECTOR_TESTING_PERSISTENT_VECTOR_HPP
+
+#include <iostream>
+#include <cassert>
+#include "persistent_vector.hpp"
+
+void test_persistent_vector_push_back_and_index();
+void test_persistent_vector_set_keeps_versions();
+void test_persistent_vector_bulk_conversion();
+void test_persistent_vector_slice();
+void test_persistent_vector_concat();
+void test_persistent_vector_random_operations();
+void test_persistent_vector_transient();
+void test_persistent_vector_transient_ownership();
+
+void run_all_persistent_vector_tests();
+
+#endif //MY_VECTOR_TESTING_PERSISTENT_VECTOR_HPP
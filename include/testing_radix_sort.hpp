@@ -0,0 +1,16 @@
+#ifndef MY_VECTOR_TESTING_RADIX_SORT_HPP
+#define MY_VECTOR_TESTING_RADIX_SORT_HPP
+
+#include <iostream>
+#include <cassert>
+#include "radix_sort.hpp"
+
+void test_radix_sort_unsigned();
+void test_radix_sort_signed();
+void test_radix_sort_floating_point();
+void test_radix_sort_key_extractor();
+void test_radix_sort_spare_capacity();
+
+void run_all_radix_sort_tests();
+
+#endif //MY_VECTOR_TESTING_RADIX_SORT_HPP
@@ -0,0 +1,15 @@
+#ifndef MY_VECTOR_TESTING_SNAPSHOT_VECTOR_HPP
+#define MY_VECTOR_TESTING_SNAPSHOT_VECTOR_HPP
+
+#include <iostream>
+#include <cassert>
+#include "snapshot_vector.hpp"
+
+void test_snapshot_vector_publish_and_read();
+void test_snapshot_vector_update();
+void test_snapshot_vector_deferred_reclamation();
+void test_snapshot_vector_concurrent_readers();
+
+void run_all_snapshot_vector_tests();
+
+#endif //MY_VECTOR_TESTING_SNAPSHOT_VECTOR_HPP
@@ -0,0 +1,19 @@
+#ifndef MY_VECTOR_TESTING_VECTOR_INGEST_HPP
+#define MY_VECTOR_TESTING_VECTOR_INGEST_HPP
+
+#include <iostream>
+#include <cassert>
+#include "vector_ingest.hpp"
+
+void test_input_iterator_constructor();
+void test_input_iterator_insert();
+void test_input_iterator_insert_rollback();
+void test_read_binary_stream();
+void test_read_binary_truncated();
+void test_read_binary_stream_error();
+void test_read_binary_fd();
+void test_read_text();
+
+void run_all_vector_ingest_tests();
+
+#endif //MY_VECTOR_TESTING_VECTOR_INGEST_HPP
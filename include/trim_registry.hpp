@@ -0,0 +1,84 @@
+#ifndef MY_VECTOR_TRIM_REGISTRY_HPP
+#define MY_VECTOR_TRIM_REGISTRY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "my_vector.hpp"
+
+// Something that can give memory back, e.g. a vector's unused capacity.
+class trimmable {
+public:
+    virtual ~trimmable() = default;
+
+    // Releases spare memory and returns the number of bytes freed. May be
+    // called from any thread; returns 0 when the object is in use.
+    virtual std::size_t trim() = 0;
+};
+
+// Process-wide set of enrolled containers that can be trimmed on memory
+// pressure.
+//
+// trim_all() may be called from any thread, e.g. a pressure watcher. Every
+// member decides in trim() whether it can be trimmed right now, so members
+// that are busy are skipped and members that sit idle are trimmed at once.
+class trim_registry {
+public:
+    static trim_registry& global();
+
+    void enroll(trimmable* member);
+    void withdraw(trimmable* member) noexcept;
+
+    // Puts to into from's place without allocating, e.g. when a member is
+    // moved.
+    void replace(trimmable* from, trimmable* to) noexcept;
+
+    // Trims every member and returns the number of bytes freed.
+    std::size_t trim_all();
+
+    [[nodiscard]] std::size_t enrolled() const;
+
+private:
+    mutable std::mutex mutex_;
+    my_vector<trimmable*> members_;
+};
+
+// Watches Linux pressure stall information (PSI) for memory and calls
+// trim_registry::global().trim_all() whenever tasks were stalled on
+// memory for more than stall_us within a window_us window. Uses the cgroup v2
+// memory.pressure file of the process' cgroup when present and the
+// system-wide /proc/pressure/memory otherwise. start() returns false when PSI
+// triggers are not available; nothing else is affected then.
+class memory_pressure_watcher {
+public:
+    explicit memory_pressure_watcher(std::uint32_t stall_us = 150000, std::uint32_t window_us = 1000000);
+    ~memory_pressure_watcher();
+
+    memory_pressure_watcher(const memory_pressure_watcher&) = delete;
+    memory_pressure_watcher& operator=(const memory_pressure_watcher&) = delete;
+
+    bool start();
+    bool start(const std::string& pressure_file);
+    void stop();
+
+    [[nodiscard]] bool running() const noexcept {
+        return thread_.joinable();
+    }
+
+    [[nodiscard]] std::uint64_t events() const noexcept {
+        return events_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::uint32_t stall_us_;
+    std::uint32_t window_us_;
+    int fd_ = -1;
+    std::atomic<bool> stopping_{false};
+    std::atomic<std::uint64_t> events_{0};
+    std::thread thread_;
+};
+
+#endif //MY_VECTOR_TRIM_REGISTRY_HPP
@@ -0,0 +1,159 @@
+#ifndef MY_VECTOR_VECTOR_INGEST_HPP
+#define MY_VECTOR_VECTOR_INGEST_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include "my_vector.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+// Streaming loaders that append to a my_vector.
+//
+// The binary loaders read trivially copyable elements in large chunks
+// directly into the vector's spare capacity, so no element is copied twice
+// and no intermediate buffer is needed. Capacity grows geometrically as the
+// input does not announce its length. The text loader parses elements with
+// operator>> in a single pass. All loaders call progress(const ingest_progress&)
+// after every chunk.
+
+struct ingest_progress {
+    std::size_t bytes = 0;
+    std::size_t elements = 0;
+};
+
+struct no_ingest_progress {
+    void operator()(const ingest_progress&) const noexcept {}
+};
+
+inline constexpr std::size_t ingest_chunk_bytes = std::size_t(1) << 20;
+
+// Appends elements read from the binary stream until end of input and
+// returns how many were appended. Throws std::runtime_error if the input ends
+// in the middle of an element, and std::ios_base::failure if reading fails
+// (badbit); the complete elements stay in out.
+template <typename T, typename Progress = no_ingest_progress>
+std::size_t read_binary(std::istream& in, my_vector<T>& out, Progress&& progress = Progress(),
+                        std::size_t chunk_bytes = ingest_chunk_bytes) {
+    static_assert(std::is_trivially_copyable_v<T>, "read_binary needs trivially copyable elements");
+
+    const std::size_t chunk = std::max<std::size_t>(1, chunk_bytes / sizeof(T));
+    const std::size_t start = out.size();
+    ingest_progress state;
+    std::size_t partial = 0;
+
+    while (in && partial == 0) {
+        out.resize_and_overwrite(out.size() + chunk, [&](T* data, std::size_t count) {
+            std::size_t old_size = out.size();
+            in.read(reinterpret_cast<char*>(data + old_size), static_cast<std::streamsize>((count - old_size) * sizeof(T)));
+            auto got = static_cast<std::size_t>(in.gcount());
+            state.bytes += got;
+            partial = got % sizeof(T);
+            return old_size + got / sizeof(T);
+        });
+        state.elements = out.size() - start;
+        progress(static_cast<const ingest_progress&>(state));
+    }
+
+    if (in.bad()) {
+        throw std::ios_base::failure("read_binary: read error");
+    }
+    if (partial != 0) {
+        throw std::runtime_error("read_binary: input ends inside an element");
+    }
+    return state.elements;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+// Same as the stream overload, but reads from a file descriptor with read(2),
+// bypassing the stream buffer. Short reads (pipes, sockets) are continued
+// until a chunk holds whole elements.
+template <typename T, typename Progress = no_ingest_progress>
+std::size_t read_binary(int fd, my_vector<T>& out, Progress&& progress = Progress(),
+                        std::size_t chunk_bytes = ingest_chunk_bytes) {
+    static_assert(std::is_trivially_copyable_v<T>, "read_binary needs trivially copyable elements");
+
+    const std::size_t chunk = std::max<std::size_t>(1, chunk_bytes / sizeof(T));
+    const std::size_t start = out.size();
+    ingest_progress state;
+    bool eof = false;
+    std::size_t partial = 0;
+
+    while (!eof) {
+        out.resize_and_overwrite(out.size() + chunk, [&](T* data, std::size_t count) {
+            std::size_t old_size = out.size();
+            char* buffer = reinterpret_cast<char*>(data + old_size);
+            std::size_t capacity_bytes = (count - old_size) * sizeof(T);
+            std::size_t got = 0;
+            // Stop at a full chunk, at end of input, or once the chunk holds
+            // whole elements after a short read.
+            while (got < capacity_bytes) {
+                ssize_t n = ::read(fd, buffer + got, capacity_bytes - got);
+                if (n < 0) {
+                    if (errno == EINTR) continue;
+                    throw std::system_error(errno, std::generic_category(), "read_binary");
+                }
+                if (n == 0) {
+                    eof = true;
+                    break;
+                }
+                got += static_cast<std::size_t>(n);
+                if (got % sizeof(T) == 0) break;
+            }
+            state.bytes += got;
+            partial = got % sizeof(T);
+            return old_size + got / sizeof(T);
+        });
+        state.elements = out.size() - start;
+        progress(static_cast<const ingest_progress&>(state));
+    }
+
+    if (partial != 0) {
+        throw std::runtime_error("read_binary: input ends inside an element");
+    }
+    return state.elements;
+}
+#endif
+
+// Appends whitespace-separated elements parsed with operator>> until the
+// stream fails, reporting progress every chunk_elements elements. Returns
+// how many were appended. A read error (badbit), unlike a parse failure,
+// throws std::ios_base::failure.
+template <typename T, typename Progress = no_ingest_progress>
+std::size_t read_text(std::istream& in, my_vector<T>& out, Progress&& progress = Progress(),
+                      std::size_t chunk_elements = ingest_chunk_bytes / sizeof(T)) {
+    const std::size_t start = out.size();
+    const std::streampos origin = in.tellg();
+    ingest_progress state;
+
+    std::istream_iterator<T> first(in);
+    std::istream_iterator<T> last;
+    for (std::size_t in_chunk = 0; first != last; ++first) {
+        out.push_back(*first);
+        if (++in_chunk == chunk_elements) {
+            in_chunk = 0;
+            state.elements = out.size() - start;
+            std::streampos here = in.tellg();
+            state.bytes = here != std::streampos(-1) && origin != std::streampos(-1)
+                          ? static_cast<std::size_t>(here - origin) : 0;
+            progress(static_cast<const ingest_progress&>(state));
+        }
+    }
+
+    if (in.bad()) {
+        throw std::ios_base::failure("read_text: read error");
+    }
+    state.elements = out.size() - start;
+    progress(static_cast<const ingest_progress&>(state));
+    return state.elements;
+}
+
+#endif //MY_VECTOR_VECTOR_INGEST_HPP
@@ -0,0 +1,139 @@
+#ifndef MY_VECTOR_WORK_STEALING_POOL_HPP
+#define MY_VECTOR_WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "my_vector.hpp"
+
+// Fork-join thread pool with one task deque per worker.
+//
+// A worker pushes forked tasks to the back of its own deque and pops from the
+// back (newest first), which keeps the working set hot in its cache. Idle
+// workers steal from the front of other deques, taking the oldest and
+// therefore largest pieces of work. Threads that wait for a join keep running
+// tasks instead of blocking, so nested fork_join never deadlocks. Threads that
+// do not belong to the pool submit through an extra shared deque.
+class work_stealing_pool {
+public:
+    explicit work_stealing_pool(unsigned threads = std::thread::hardware_concurrency());
+    ~work_stealing_pool();
+
+    work_stealing_pool(const work_stealing_pool&) = delete;
+    work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+    // Process-wide pool sized to the hardware, created on first use.
+    static work_stealing_pool& global();
+
+    // Number of threads that execute tasks, including the caller of fork_join.
+    [[nodiscard]] unsigned concurrency() const noexcept {
+        return static_cast<unsigned>(workers_.size()) + 1;
+    }
+
+    // Runs left and right, possibly in parallel, and returns when both are
+    // done. An exception from either of them is rethrown here.
+    template <typename Left, typename Right>
+    void fork_join(Left&& left, Right&& right) {
+        struct job_state : job {
+            std::remove_reference_t<Right>* body;
+            std::exception_ptr error;
+
+            static void run(job* self) {
+                auto* state = static_cast<job_state*>(self);
+                try {
+                    (*state->body)();
+                } catch (...) {
+                    state->error = std::current_exception();
+                }
+                state->done.store(true, std::memory_order_release);
+            }
+        };
+
+        job_state right_job;
+        right_job.execute = &job_state::run;
+        right_job.body = &right;
+        push(&right_job);
+
+        std::exception_ptr left_error;
+        try {
+            left();
+        } catch (...) {
+            left_error = std::current_exception();
+        }
+
+        wait_for(right_job);
+        if (left_error) std::rethrow_exception(left_error);
+        if (right_job.error) std::rethrow_exception(right_job.error);
+    }
+
+    // Runs task on some thread of the pool later and returns at once. The
+    // task must not throw. Tasks posted before the pool is destroyed still
+    // run; a pool without workers only runs them inside run_until() or the
+    // destructor.
+    template <typename F>
+    void post(F&& task) {
+        struct posted_job : job {
+            std::decay_t<F> body;
+
+            explicit posted_job(F&& f) : body(std::forward<F>(f)) {}
+
+            static void run(job* self) noexcept {
+                std::unique_ptr<posted_job> owned(static_cast<posted_job*>(self));
+                owned->body();
+            }
+        };
+
+        auto* posted = new posted_job(std::forward<F>(task));
+        posted->execute = &posted_job::run;
+        push(posted);
+    }
+
+    // Runs tasks on the calling thread until done() returns true.
+    template <typename Done>
+    void run_until(Done&& done) {
+        while (!done()) {
+            if (!run_one()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    struct job {
+        void (*execute)(job*) = nullptr;
+        std::atomic<bool> done{false};
+    };
+
+    struct task_queue {
+        std::mutex mutex;
+        std::deque<job*> jobs;
+    };
+
+    my_vector<std::thread> workers_;
+    // One queue per worker plus the shared queue for outside threads (last).
+    std::unique_ptr<task_queue[]> queues_;
+    std::size_t queue_count_ = 0;
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    std::atomic<std::size_t> pending_{0};
+    bool stopping_ = false;
+
+    void push(job* task);
+    job* pop_local();
+    job* steal();
+    bool run_one();
+    void wait_for(const job& task);
+    void worker_loop(std::size_t index);
+
+    std::size_t local_queue() const noexcept;
+};
+
+#endif //MY_VECTOR_WORK_STEALING_POOL_HPP
@@ -0,0 +1,84 @@
+#include "benchmark_d_ary_heap.hpp"
+#include <cstdint>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t element_count = 2'000'000;
+
+// Key plus payload, so the element size can be varied.
+template <std::size_t Bytes>
+struct item {
+    std::uint64_t key;
+    unsigned char payload[Bytes - sizeof(std::uint64_t)];
+
+    bool operator<(const item& other) const noexcept {
+        return key < other.key;
+    }
+};
+
+template <>
+struct item<8> {
+    std::uint64_t key;
+
+    bool operator<(const item& other) const noexcept {
+        return key < other.key;
+    }
+};
+
+template <typename Queue, typename T>
+void push_then_pop(const std::string& name, const my_vector<T>& input) {
+    Queue queue;
+    measure(name + ": push", input.size(), [&] {
+        for (const T& value : input) {
+            queue.push(value);
+        }
+    });
+    std::uint64_t checksum = 0;
+    measure(name + ": pop", input.size(), [&] {
+        while (!queue.empty()) {
+            checksum += queue.top().key;
+            queue.pop();
+        }
+    });
+    do_not_optimize(&checksum);
+}
+
+template <std::size_t Bytes>
+void run_element_size() {
+    using T = item<Bytes>;
+    std::mt19937_64 rng(42);
+    my_vector<T> input(element_count);
+    for (T& value : input) {
+        value.key = rng();
+    }
+
+    std::string size = std::to_string(Bytes) + "B";
+    push_then_pop<std::priority_queue<T>>("std::priority_queue " + size, input);
+    push_then_pop<d_ary_heap<T, 2>>("d_ary_heap<2> " + size, input);
+    push_then_pop<d_ary_heap<T, 4>>("d_ary_heap<4> " + size, input);
+    push_then_pop<d_ary_heap<T, 8>>("d_ary_heap<8> " + size, input);
+
+    d_ary_heap<T, 4> bulk;
+    measure("d_ary_heap<4> " + size + ": push_range", input.size(), [&] {
+        bulk.push_range(input);
+    });
+    do_not_optimize(&bulk);
+    std::cout << '\n';
+}
+
+} // namespace
+
+void run_all_d_ary_heap_benchmarks() {
+    std::cout << "Starting d_ary_heap benchmarks (" << element_count << " elements)...\n\n";
+
+    run_element_size<8>();
+    run_element_size<32>();
+    run_element_size<64>();
+
+    std::cout << std::endl;
+}
@@ -0,0 +1,63 @@
+#include "benchmark_flat_hash_map.hpp"
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+constexpr std::size_t element_count = 1'000'000;
+
+template <typename Map>
+void run_map_benchmarks(const std::string& name, const my_vector<std::uint64_t>& keys,
+                        const my_vector<std::uint64_t>& misses) {
+    Map map;
+    measure(name + ": insert", keys.size(), [&] {
+        for (std::uint64_t key : keys) {
+            map[key] = key;
+        }
+    });
+
+    std::uint64_t found = 0;
+    measure(name + ": lookup hit", keys.size(), [&] {
+        for (std::uint64_t key : keys) {
+            found += map.find(key)->second;
+        }
+    });
+    measure(name + ": lookup miss", misses.size(), [&] {
+        for (std::uint64_t key : misses) {
+            found += map.find(key) == map.end() ? 0 : 1;
+        }
+    });
+    do_not_optimize(&found);
+
+    measure(name + ": erase", keys.size(), [&] {
+        for (std::uint64_t key : keys) {
+            map.erase(key);
+        }
+    });
+    do_not_optimize(&map);
+}
+
+} // namespace
+
+void run_all_flat_hash_map_benchmarks() {
+    std::cout << "Starting flat hash map benchmarks (" << element_count << " uint64 keys)...\n\n";
+
+    std::mt19937_64 rng(42);
+    my_vector<std::uint64_t> keys;
+    my_vector<std::uint64_t> misses;
+    keys.reserve(element_count);
+    misses.reserve(element_count);
+    // Odd keys are inserted, even keys are looked up as misses.
+    for (std::size_t i = 0; i < element_count; ++i) {
+        keys.push_back(rng() | 1);
+        misses.push_back(rng() & ~std::uint64_t(1));
+    }
+
+    run_map_benchmarks<std::unordered_map<std::uint64_t, std::uint64_t>>("std::unordered_map", keys, misses);
+    run_map_benchmarks<flat_hash_map<std::uint64_t, std::uint64_t>>("flat_hash_map", keys, misses);
+
+    std::cout << std::endl;
+}
@@ -0,0 +1,71 @@
+#include "benchmark_my_vector.hpp"
+#include <iostream>
+#include <string>
+
+namespace {
+
+constexpr std::size_t large_count = 10'000'000;
+constexpr std::size_t small_count = 20'000;
+
+} // namespace
+
+void benchmark_push_back() {
+    measure("push_back (growing)", large_count, [] {
+        my_vector<std::size_t> v;
+        for (std::size_t i = 0; i < large_count; ++i) {
+            v.push_back(i);
+        }
+        do_not_optimize(v.data());
+    });
+}
+
+void benchmark_push_back_reserved() {
+    measure("push_back (reserved)", large_count, [] {
+        my_vector<std::size_t> v;
+        v.reserve(large_count);
+        for (std::size_t i = 0; i < large_count; ++i) {
+            v.push_back(i);
+        }
+        do_not_optimize(v.data());
+    });
+}
+
+void benchmark_insert_front() {
+    measure("insert at front", small_count, [] {
+        my_vector<std::string> v;
+        for (std::size_t i = 0; i < small_count; ++i) {
+            v.insert(v.begin(), "value");
+        }
+        do_not_optimize(v.data());
+    });
+}
+
+void benchmark_erase_front() {
+    my_vector<std::string> v(small_count, "value");
+    measure("erase at front", small_count, [&v] {
+        while (!v.empty()) {
+            v.erase(v.begin());
+        }
+        do_not_optimize(v.data());
+    });
+}
+
+void benchmark_reallocate() {
+    my_vector<std::string> v(large_count / 10, "a string long enough to allocate");
+    measure("reallocate (reserve x2)", v.size(), [&v] {
+        v.reserve(v.capacity() * 2);
+        do_not_optimize(v.data());
+    });
+}
+
+void run_all_my_vector_benchmarks() {
+    std::cout << "Starting my_vector benchmarks...\n\n";
+
+    benchmark_push_back();
+    benchmark_push_back_reserved();
+    benchmark_insert_front();
+    benchmark_erase_front();
+    benchmark_reallocate();
+
+    std::cout << std::endl;
+}
@@ -0,0 +1,40 @@
+#include "benchmark_numa.hpp"
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace {
+
+constexpr std::size_t element_count = 16'000'000;
+constexpr int passes = 5;
+
+} // namespace
+
+void benchmark_numa_bandwidth(numa_policy policy, const char* name) {
+    my_vector<std::uint64_t> v;
+    measure(std::string(name) + ": parallel first touch", element_count, [&] {
+        v = make_numa_vector<std::uint64_t>(element_count, 1, policy);
+    });
+
+    std::uint64_t sum = 0;
+    perf_counters::sample read = measure(std::string(name) + ": parallel read", element_count * passes, [&] {
+        for (int i = 0; i < passes; ++i) {
+            sum += parallel_reduce(v, std::uint64_t(0));
+        }
+    });
+    do_not_optimize(sum);
+
+    double bytes = static_cast<double>(element_count) * passes * sizeof(std::uint64_t);
+    std::cout << "  " << name << " read bandwidth: " << bytes / read.wall_ns << " GB/s" << std::endl;
+}
+
+void run_all_numa_benchmarks() {
+    std::cout << "Starting NUMA bandwidth benchmarks (" << numa_node_count() << " node(s), "
+              << work_stealing_pool::global().concurrency() << " thread(s))...\n\n";
+
+    benchmark_numa_bandwidth(numa_policy::local, "local");
+    benchmark_numa_bandwidth(numa_policy::interleaved, "interleaved");
+    benchmark_numa_bandwidth(numa_policy::partitioned, "partitioned");
+
+    std::cout << std::endl;
+}
@@ -0,0 +1,61 @@
+#include "benchmark_radix_sort.hpp"
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr std::size_t element_count = 10'000'000;
+
+struct record {
+    std::uint64_t key;
+    std::uint64_t payload;
+};
+
+template <typename T, typename Generator>
+my_vector<T> random_vector(Generator generate) {
+    std::mt19937_64 rng(42);
+    my_vector<T> v;
+    v.reserve(element_count);
+    for (std::size_t i = 0; i < element_count; ++i) {
+        v.push_back(generate(rng));
+    }
+    return v;
+}
+
+template <typename T, typename Generator, typename KeyFn>
+void compare_with_std_sort(const std::string& name, Generator generate, KeyFn key) {
+    my_vector<T> input = random_vector<T>(generate);
+
+    my_vector<T> v(input);
+    measure(name + ": std::sort", element_count, [&] {
+        std::sort(v.begin(), v.end(), [&](const T& lhs, const T& rhs) { return key(lhs) < key(rhs); });
+    });
+    v = input;
+    measure(name + ": radix_sort", element_count, [&] {
+        radix_sort(v, key);
+    });
+    do_not_optimize(v.data());
+}
+
+} // namespace
+
+void run_all_radix_sort_benchmarks() {
+    std::cout << "Starting radix sort benchmarks (" << work_stealing_pool::global().concurrency()
+              << " thread(s))...\n\n";
+
+    compare_with_std_sort<std::uint32_t>(
+            "uint32", [](std::mt19937_64& rng) { return static_cast<std::uint32_t>(rng()); },
+            [](std::uint32_t x) { return x; });
+    compare_with_std_sort<std::uint64_t>(
+            "uint64", [](std::mt19937_64& rng) { return rng(); }, [](std::uint64_t x) { return x; });
+    compare_with_std_sort<float>(
+            "float", [](std::mt19937_64& rng) { return std::uniform_real_distribution<float>(-1e9f, 1e9f)(rng); },
+            [](float x) { return x; });
+    compare_with_std_sort<record>(
+            "record by uint64 key", [](std::mt19937_64& rng) { return record{rng(), 0}; },
+            [](const record& r) { return r.key; });
+
+    std::cout << std::endl;
+}
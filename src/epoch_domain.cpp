@@ -0,0 +1,65 @@
+#include "epoch_domain.hpp"
+
+#include <algorithm>
+
+epoch_domain& epoch_domain::global() {
+    // Leaked on purpose: thread_local slots may outlive static destructors.
+    static epoch_domain* domain = new epoch_domain;
+    return *domain;
+}
+
+epoch_domain::reader_slot* epoch_domain::register_thread() {
+    for (reader_slot* slot = slots_.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+        bool expected = false;
+        if (slot->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            local_.slot = slot;
+            return slot;
+        }
+    }
+
+    auto* slot = new reader_slot;
+    slot->next = slots_.load(std::memory_order_relaxed);
+    while (!slots_.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    local_.slot = slot;
+    return slot;
+}
+
+void epoch_domain::retire(void* object, void (*deleter)(void*)) {
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    // Readers that announce the advanced epoch entered after the object was
+    // unpublished and cannot see it.
+    retired_.push_back({object, deleter, epoch_.fetch_add(1, std::memory_order_seq_cst)});
+    reclaim_locked();
+}
+
+std::size_t epoch_domain::reclaim() {
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    return reclaim_locked();
+}
+
+std::size_t epoch_domain::reclaim_locked() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::uint64_t oldest = idle;
+    for (reader_slot* slot = slots_.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+        oldest = std::min(oldest, slot->epoch.load(std::memory_order_acquire));
+    }
+
+    std::size_t kept = 0;
+    std::size_t freed = 0;
+    for (retired_object& entry : retired_) {
+        if (entry.epoch < oldest) {
+            entry.deleter(entry.object);
+            ++freed;
+        } else {
+            retired_[kept++] = entry;
+        }
+    }
+    retired_.resize(kept);
+    return freed;
+}
+
+std::size_t epoch_domain::pending() const {
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    return retired_.size();
+}
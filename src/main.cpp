@@ -3,11 +3,58 @@
 
 #include "testing_my_vector.hpp"
 #include "testing_my_array.hpp"
+#include "testing_flat_containers.hpp"
+#include "testing_bit_vector.hpp"
+#include "testing_compressed_vector.hpp"
+#include "testing_perf_counters.hpp"
+#include "testing_parallel_algorithms.hpp"
+#include "testing_vector_ingest.hpp"
+#include "testing_numa_placement.hpp"
+#include "testing_decaying_vector.hpp"
+#include "testing_radix_sort.hpp"
+#include "testing_flat_hash_map.hpp"
+#include "testing_gap_buffer.hpp"
+#include "testing_inplace_vector.hpp"
+#include "testing_snapshot_vector.hpp"
+#include "testing_persistent_vector.hpp"
+#include "testing_d_ary_heap.hpp"
+#include "testing_chunk_pipeline.hpp"
+#include "benchmark_my_vector.hpp"
+#include "benchmark_numa.hpp"
+#include "benchmark_radix_sort.hpp"
+#include "benchmark_flat_hash_map.hpp"
+#include "benchmark_d_ary_heap.hpp"
+#include <cstring>
 
 
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::strcmp(argv[1], "--bench") == 0) {
+        run_all_my_vector_benchmarks();
+        run_all_numa_benchmarks();
+        run_all_radix_sort_benchmarks();
+        run_all_flat_hash_map_benchmarks();
+        run_all_d_ary_heap_benchmarks();
+        return 0;
+    }
+
     run_all_tests();
     run_all_array_tests();
+    run_all_flat_container_tests();
+    run_all_bit_vector_tests();
+    run_all_compressed_vector_tests();
+    run_all_perf_counter_tests();
+    run_all_parallel_algorithm_tests();
+    run_all_vector_ingest_tests();
+    run_all_numa_placement_tests();
+    run_all_decaying_vector_tests();
+    run_all_radix_sort_tests();
+    run_all_flat_hash_map_tests();
+    run_all_gap_buffer_tests();
+    run_all_inplace_vector_tests();
+    run_all_snapshot_vector_tests();
+    run_all_persistent_vector_tests();
+    run_all_d_ary_heap_tests();
+    run_all_chunk_pipeline_tests();
 
     return 0;
 }
@@ -0,0 +1,126 @@
+#include "numa_placement.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using node_mask = detail::numa_node_mask;
+constexpr std::size_t max_nodes = std::numeric_limits<node_mask>::digits;
+
+// The nodes that have memory; node 0 alone if unknown.
+node_mask memory_nodes() {
+    static const node_mask nodes = [] {
+        std::ifstream in("/sys/devices/system/node/has_memory");
+        std::string list;
+        if (!(in >> list)) return node_mask(1);
+        try {
+            node_mask parsed = detail::parse_numa_node_list(list);
+            return parsed == 0 ? node_mask(1) : parsed;
+        } catch (const std::exception&) {
+            return node_mask(1);
+        }
+    }();
+    return nodes;
+}
+
+#if defined(__linux__)
+long call_mbind(void* addr, std::size_t len, int mode, node_mask mask, unsigned flags) {
+    return syscall(SYS_mbind, addr, len, mode, mode == MPOL_DEFAULT ? nullptr : &mask, max_nodes + 1, flags);
+}
+
+// The set bit of mask after node, wrapping around to the lowest one.
+unsigned next_node(node_mask mask, unsigned node) {
+    node_mask above = node + 1 < max_nodes ? mask & (~node_mask(0) << (node + 1)) : 0;
+    return static_cast<unsigned>(std::countr_zero(above != 0 ? above : mask));
+}
+#endif
+
+} // namespace
+
+detail::numa_node_mask detail::parse_numa_node_list(const std::string& list) {
+    node_mask mask = 0;
+    std::size_t pos = 0;
+    while (pos < list.size()) {
+        std::size_t end = list.find(',', pos);
+        std::string range = list.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+        std::size_t dash = range.find('-');
+        unsigned long first = std::stoul(range.substr(0, dash));
+        unsigned long last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+        for (unsigned long node = first; node <= last && node < max_nodes; ++node) {
+            mask |= node_mask(1) << node;
+        }
+        if (end == std::string::npos) break;
+        pos = end + 1;
+    }
+    return mask;
+}
+
+unsigned numa_node_count() {
+    return static_cast<unsigned>(std::popcount(memory_nodes()));
+}
+
+bool numa_bind(void* addr, std::size_t bytes, numa_policy policy, std::size_t chunk_bytes) {
+#if defined(__linux__)
+    node_mask nodes = memory_nodes();
+    if (std::popcount(nodes) < 2 || bytes == 0) return false;
+
+    const auto page = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    auto begin = (reinterpret_cast<std::uintptr_t>(addr) + page - 1) / page * page;
+    auto end = (reinterpret_cast<std::uintptr_t>(addr) + bytes) / page * page;
+    if (begin >= end) return false;
+
+    switch (policy) {
+        case numa_policy::local:
+            return call_mbind(reinterpret_cast<void*>(begin), end - begin, MPOL_DEFAULT, 0, MPOL_MF_MOVE) == 0;
+        case numa_policy::interleaved:
+            return call_mbind(reinterpret_cast<void*>(begin), end - begin, MPOL_INTERLEAVE, nodes, MPOL_MF_MOVE) == 0;
+        case numa_policy::partitioned: {
+            std::uintptr_t chunk = std::max<std::uintptr_t>(page, (chunk_bytes + page - 1) / page * page);
+            bool ok = true;
+            unsigned node = static_cast<unsigned>(std::countr_zero(nodes));
+            for (std::uintptr_t piece = begin; piece < end; piece += chunk, node = next_node(nodes, node)) {
+                std::uintptr_t len = std::min(chunk, end - piece);
+                ok = call_mbind(reinterpret_cast<void*>(piece), len, MPOL_PREFERRED,
+                                node_mask(1) << node, MPOL_MF_MOVE) == 0 && ok;
+            }
+            return ok;
+        }
+    }
+#else
+    static_cast<void>(addr);
+    static_cast<void>(bytes);
+    static_cast<void>(policy);
+    static_cast<void>(chunk_bytes);
+#endif
+    return false;
+}
+
+numa_thread_policy::numa_thread_policy(numa_policy policy) {
+#if defined(__linux__)
+    node_mask mask = memory_nodes();
+    if (std::popcount(mask) < 2 || policy == numa_policy::local) return;
+    active_ = syscall(SYS_set_mempolicy, MPOL_INTERLEAVE, &mask, max_nodes + 1) == 0;
+#else
+    static_cast<void>(policy);
+#endif
+}
+
+numa_thread_policy::~numa_thread_policy() {
+#if defined(__linux__)
+    if (active_) {
+        syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0);
+    }
+#endif
+}
@@ -0,0 +1,141 @@
+#include "perf_counters.hpp"
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#if defined(__linux__)
+int open_event(std::uint32_t type, std::uint64_t config) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    // Counting user space only keeps this working with perf_event_paranoid = 2.
+    attr.exclude_kernel = type == PERF_TYPE_HARDWARE ? 1 : 0;
+    attr.exclude_hv = 1;
+    // With more events than hardware counters the kernel multiplexes them;
+    // the enabled and running times let stop() scale the counts back up.
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+long rusage_page_faults() {
+    rusage usage{};
+    getrusage(RUSAGE_THREAD, &usage);
+    return usage.ru_minflt + usage.ru_majflt;
+}
+#endif
+
+} // namespace
+
+perf_counters::perf_counters(bool open_events) {
+    for (int& fd : fds_) {
+        fd = -1;
+    }
+#if defined(__linux__)
+    if (!open_events) return;
+    fds_[cycles] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    fds_[instructions] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fds_[cache_misses] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    fds_[branch_misses] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    fds_[page_faults] = open_event(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+#else
+    static_cast<void>(open_events);
+#endif
+}
+
+perf_counters::~perf_counters() {
+#if defined(__linux__)
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+#endif
+}
+
+bool perf_counters::available(event e) const noexcept {
+#if defined(__linux__)
+    return fds_[e] >= 0 || e == page_faults;
+#else
+    return false;
+#endif
+}
+
+const char* perf_counters::event_name(event e) noexcept {
+    switch (e) {
+        case cycles: return "cycles";
+        case instructions: return "instructions";
+        case cache_misses: return "cache-misses";
+        case branch_misses: return "branch-misses";
+        case page_faults: return "page-faults";
+        default: return "unknown";
+    }
+}
+
+void perf_counters::start() {
+#if defined(__linux__)
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    rusage_faults_ = rusage_page_faults();
+#endif
+    started_ = std::chrono::steady_clock::now();
+}
+
+perf_counters::sample perf_counters::stop() {
+    sample result;
+    result.wall_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started_).count();
+#if defined(__linux__)
+    long faults = rusage_page_faults();
+    for (std::size_t e = 0; e < event_count; ++e) {
+        if (fds_[e] < 0) continue;
+        ioctl(fds_[e], PERF_EVENT_IOC_DISABLE, 0);
+        // value, time enabled, time running
+        std::uint64_t data[3] = {};
+        if (read(fds_[e], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+            continue;
+        }
+        result.values[e] = data[2] == data[1]
+                ? data[0]
+                : static_cast<std::uint64_t>(static_cast<double>(data[0]) * static_cast<double>(data[1]) /
+                                             static_cast<double>(data[2]));
+        result.valid[e] = true;
+    }
+    if (!result.valid[page_faults]) {
+        result.values[page_faults] = static_cast<std::uint64_t>(faults - rusage_faults_);
+        result.valid[page_faults] = true;
+    }
+#endif
+    return result;
+}
+
+void print_sample(const std::string& name, std::size_t ops, const perf_counters::sample& result) {
+    double per_op = ops > 0 ? 1.0 / static_cast<double>(ops) : 1.0;
+    std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << result.wall_ns * per_op << " ns/op";
+    for (std::size_t e = 0; e < perf_counters::event_count; ++e) {
+        std::cout << "  " << perf_counters::event_name(static_cast<perf_counters::event>(e)) << ": ";
+        if (result.valid[e]) {
+            std::cout << static_cast<double>(result.values[e]) * per_op;
+        } else {
+            std::cout << "n/a";
+        }
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,113 @@
+#include "testing_bit_vector.hpp"
+
+
+void test_bit_vector_push_back() {
+    std::cout << "Running test_bit_vector_push_back... ";
+    bit_vector bits;
+    for (int i = 0; i < 130; ++i) {
+        bits.push_back(i % 3 == 0);
+    }
+    assert(bits.size() == 130);
+    assert(bits.word_count() == 3);
+    for (int i = 0; i < 130; ++i) {
+        assert(bits[i] == (i % 3 == 0));
+    }
+    bits.pop_back();
+    bits.pop_back();
+    assert(bits.size() == 128);
+    assert(bits.word_count() == 2);
+    std::cout << "Passed!\n";
+}
+
+void test_bit_vector_proxy_reference() {
+    std::cout << "Running test_bit_vector_proxy_reference... ";
+    bit_vector bits(10);
+    bits[3] = true;
+    bits[4] = bits[3];
+    bits[3].flip();
+    assert(!bits[3]);
+    assert(bits[4]);
+    assert(bits.at(4));
+    bool thrown = false;
+    try {
+        bits.at(10);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Passed!\n";
+}
+
+void test_bit_vector_resize() {
+    std::cout << "Running test_bit_vector_resize... ";
+    bit_vector bits(3, true);
+    bits.resize(70, true);
+    assert(bits.count() == 70);
+    bits.resize(5);
+    assert(bits.count() == 5);
+    bits.resize(100);
+    assert(bits.count() == 5);
+    std::cout << "Passed!\n";
+}
+
+void test_bit_vector_count() {
+    std::cout << "Running test_bit_vector_count... ";
+    bit_vector bits(200);
+    assert(bits.none());
+    bits.set(0);
+    bits.set(64);
+    bits.set(199);
+    assert(bits.count() == 3);
+    bits.flip();
+    assert(bits.count() == 197);
+    bits.set();
+    assert(bits.all());
+    std::cout << "Passed!\n";
+}
+
+void test_bit_vector_find() {
+    std::cout << "Running test_bit_vector_find... ";
+    bit_vector bits(300);
+    assert(bits.find_first() == bit_vector::npos);
+    bits.set(5);
+    bits.set(63);
+    bits.set(64);
+    bits.set(299);
+    assert(bits.find_first() == 5);
+    assert(bits.find_next(5) == 63);
+    assert(bits.find_next(63) == 64);
+    assert(bits.find_next(64) == 299);
+    assert(bits.find_next(299) == bit_vector::npos);
+    std::cout << "Passed!\n";
+}
+
+void test_bit_vector_bitwise_operations() {
+    std::cout << "Running test_bit_vector_bitwise_operations... ";
+    bit_vector a = {true, true, false, false};
+    bit_vector b = {true, false, true, false};
+    assert((a & b) == bit_vector({true, false, false, false}));
+    assert((a | b) == bit_vector({true, true, true, false}));
+    assert((a ^ b) == bit_vector({false, true, true, false}));
+    assert(~a == bit_vector({false, false, true, true}));
+    bool thrown = false;
+    try {
+        a &= bit_vector(5);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Passed!\n";
+}
+
+void run_all_bit_vector_tests() {
+    std::cout << "Starting all bit_vector tests...\n\n";
+
+    test_bit_vector_push_back();
+    test_bit_vector_proxy_reference();
+    test_bit_vector_resize();
+    test_bit_vector_count();
+    test_bit_vector_find();
+    test_bit_vector_bitwise_operations();
+
+    std::cout << "\n\033[3;42;30m  All bit_vector tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,295 @@
+#include "testing_chunk_pipeline.hpp"
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+
+namespace {
+
+async_generator<int> count_to(int n) {
+    for (int i = 1; i <= n; ++i) {
+        co_yield i;
+    }
+}
+
+async_generator<int> squares(async_generator<int> in) {
+    while (int* value = co_await in.next()) {
+        co_yield *value * *value;
+    }
+}
+
+// Stage that works in place.
+chunk_stream<long> doubled(chunk_stream<long> in) {
+    while (pooled_chunk<long>* chunk = co_await in.next()) {
+        for (long& value : **chunk) {
+            value *= 2;
+        }
+        co_yield std::move(*chunk);
+    }
+}
+
+// Stage that writes into fresh chunks of its own.
+chunk_stream<long> odd_only(chunk_stream<long> in, chunk_pool<long> pool) {
+    while (pooled_chunk<long>* chunk = co_await in.next()) {
+        pooled_chunk<long> out = pool.acquire();
+        for (long value : **chunk) {
+            if (value % 2 != 0) out->push_back(value);
+        }
+        co_yield std::move(out);
+    }
+}
+
+chunk_stream<long> failing_after(chunk_stream<long> in, std::size_t chunks) {
+    while (pooled_chunk<long>* chunk = co_await in.next()) {
+        if (chunks-- == 0) {
+            throw std::runtime_error("stage failed");
+        }
+        co_yield std::move(*chunk);
+    }
+}
+
+// Stage that counts how many of its kind are alive.
+chunk_stream<long> counted(chunk_stream<long> in, std::atomic<int>& alive) {
+    struct alive_guard {
+        std::atomic<int>& count;
+
+        ~alive_guard() {
+            --count;
+        }
+    } guard{alive};
+    ++alive;
+
+    while (pooled_chunk<long>* chunk = co_await in.next()) {
+        co_yield std::move(*chunk);
+    }
+}
+
+my_vector<long> iota_vector(std::size_t n) {
+    my_vector<long> values(n);
+    std::iota(values.begin(), values.end(), 0L);
+    return values;
+}
+
+} // namespace
+
+void test_async_generator() {
+    std::cout << "Running test_async_generator... ";
+    int sum = 0;
+    drain(squares(count_to(10)), [&](int value) { sum += value; });
+    assert(sum == 385);
+
+    // Stopping early destroys the suspended generators.
+    int seen = 0;
+    bool stopped = false;
+    try {
+        drain(count_to(1000), [&](int value) {
+            if (value == 3) throw std::out_of_range("enough");
+            ++seen;
+        });
+    } catch (const std::out_of_range&) {
+        stopped = true;
+    }
+    assert(stopped && seen == 2);
+    std::cout << "Passed!\n";
+}
+
+void test_chunk_pool_recycling() {
+    std::cout << "Running test_chunk_pool_recycling... ";
+    chunk_pool<int> pool(64, 2);
+    {
+        pooled_chunk<int> a = pool.acquire();
+        a->push_back(1);
+        assert(a->capacity() >= 64);
+    }
+    pooled_chunk<int> b = pool.acquire();
+    assert(b->empty() && pool.allocated() == 1);
+    {
+        pooled_chunk<int> c = pool.acquire();
+        pooled_chunk<int> d = pool.acquire();
+        pooled_chunk<int> e = pool.acquire();
+    }
+    assert(pool.allocated() == 4);
+    // Only two of the three buffers were kept.
+    pooled_chunk<int> f = pool.acquire();
+    pooled_chunk<int> g = pool.acquire();
+    pooled_chunk<int> h = pool.acquire();
+    assert(pool.allocated() == 5);
+
+    h->push_back(7);
+    my_vector<int> kept = h.release();
+    assert(kept.size() == 1 && kept[0] == 7);
+    std::cout << "Passed!\n";
+}
+
+void test_chunk_pipeline_stages() {
+    std::cout << "Running test_chunk_pipeline_stages... ";
+    my_vector<long> input = iota_vector(10'000);
+    chunk_pool<long> pool(256);
+    chunk_pool<long> out_pool(256);
+
+    my_vector<long> output;
+    drain(odd_only(chunks_of(input.begin(), input.end(), pool), out_pool),
+          [&](pooled_chunk<long>& chunk) { output.insert(output.end(), chunk->begin(), chunk->end()); });
+    assert(output.size() == 5000 && output.front() == 1 && output.back() == 9999);
+
+    long total = 0;
+    std::size_t chunks = 0;
+    drain(doubled(chunks_of(input.begin(), input.end(), pool)), [&](pooled_chunk<long>& chunk) {
+        assert(chunk->size() <= 256);
+        total = std::accumulate(chunk->begin(), chunk->end(), total);
+        ++chunks;
+    });
+    assert(total == 9'999L * 10'000L && chunks == 40);
+    // Run one after another, the stages pass a single buffer along.
+    assert(pool.allocated() <= 2);
+    std::cout << "Passed!\n";
+}
+
+void test_chunk_pipeline_buffered() {
+    std::cout << "Running test_chunk_pipeline_buffered... ";
+    my_vector<long> input = iota_vector(200'000);
+    work_stealing_pool workers(4);
+    chunk_pool<long> pool(1000);
+
+    my_vector<long> output;
+    chunk_stream<long> source = buffered(chunks_of(input.begin(), input.end(), pool), 2, workers);
+    chunk_stream<long> stage = buffered(doubled(std::move(source)), 2, workers);
+    drain(std::move(stage), [&](pooled_chunk<long>& chunk) {
+        output.insert(output.end(), chunk->begin(), chunk->end());
+    }, workers);
+
+    assert(output.size() == input.size());
+    for (std::size_t i = 0; i < output.size(); ++i) {
+        assert(output[i] == 2 * input[i]);
+    }
+
+    // The global pool works as well, even without worker threads.
+    long total = 0;
+    drain(buffered(chunks_of(input.begin(), input.end(), pool), 4), [&](pooled_chunk<long>& chunk) {
+        total = std::accumulate(chunk->begin(), chunk->end(), total);
+    });
+    assert(total == 199'999L * 200'000L / 2);
+    std::cout << "Passed!\n";
+}
+
+void test_chunk_pipeline_backpressure() {
+    std::cout << "Running test_chunk_pipeline_backpressure... ";
+    my_vector<long> input = iota_vector(1'000'000);
+    work_stealing_pool workers(4);
+    chunk_pool<long> pool(1000);
+
+    std::size_t chunks = 0;
+    drain(buffered(doubled(buffered(chunks_of(input.begin(), input.end(), pool), 2, workers)), 2, workers),
+          [&](pooled_chunk<long>&) { ++chunks; }, workers);
+    assert(chunks == 1000);
+    // A thousand chunks went through, but only the few that fit into the
+    // queues and stages at a time were ever allocated.
+    assert(pool.allocated() <= 12);
+
+    // A consumer that stops early lets the producers behind it stop too.
+    bool stopped = false;
+    try {
+        drain(buffered(chunks_of(input.begin(), input.end(), pool), 2, workers), [&](pooled_chunk<long>& chunk) {
+            if ((*chunk)[0] >= 5000) throw std::out_of_range("enough");
+        }, workers);
+    } catch (const std::out_of_range&) {
+        stopped = true;
+    }
+    assert(stopped);
+    std::cout << "Passed!\n";
+}
+
+void test_chunk_pipeline_errors() {
+    std::cout << "Running test_chunk_pipeline_errors... ";
+    my_vector<long> input = iota_vector(10'000);
+    work_stealing_pool workers(3);
+    chunk_pool<long> pool(100);
+
+    std::size_t received = 0;
+    bool thrown = false;
+    try {
+        drain(buffered(failing_after(buffered(chunks_of(input.begin(), input.end(), pool), 3, workers), 5), 3, workers),
+              [&](pooled_chunk<long>&) { ++received; }, workers);
+    } catch (const std::runtime_error& error) {
+        thrown = std::string(error.what()) == "stage failed";
+    }
+    // Everything produced before the failure is delivered first.
+    assert(thrown && received == 5);
+
+    thrown = false;
+    try {
+        chunk_pool<long> invalid(0);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Passed!\n";
+}
+
+void test_chunk_pipeline_consumer_threads() {
+    std::cout << "Running test_chunk_pipeline_consumer_threads... ";
+    my_vector<long> input = iota_vector(200'000);
+    work_stealing_pool workers(4);
+    chunk_pool<long> pool(100);
+
+    // consume may run on pool workers, but never twice at the same time.
+    std::atomic<int> active{0};
+    std::atomic<bool> overlapped{false};
+    long total = 0;
+    drain(buffered(doubled(buffered(chunks_of(input.begin(), input.end(), pool), 2, workers)), 2, workers),
+          [&](pooled_chunk<long>& chunk) {
+              if (active.fetch_add(1) != 0) overlapped = true;
+              total = std::accumulate(chunk->begin(), chunk->end(), total);
+              active.fetch_sub(1);
+          }, workers);
+    assert(!overlapped.load() && total == 199'999L * 200'000L);
+    std::cout << "Passed!\n";
+}
+
+void test_chunk_pipeline_early_stop() {
+    std::cout << "Running test_chunk_pipeline_early_stop... ";
+    std::atomic<int> alive{0};
+    std::size_t received = 0;
+    for (int round = 0; round < 20; ++round) {
+        auto input = std::make_unique<my_vector<long>>(iota_vector(100'000));
+        chunk_pool<long> pool(100);
+        bool stopped = false;
+        try {
+            drain(buffered(counted(buffered(chunks_of(input->begin(), input->end(), pool), 2), alive), 2),
+                  [&](pooled_chunk<long>&) {
+                      if (++received % 3 == 0) throw std::out_of_range("enough");
+                  });
+        } catch (const std::out_of_range&) {
+            stopped = true;
+        }
+        // Every stage is gone once drain returns, so the input can go too.
+        assert(stopped && alive.load() == 0);
+        input.reset();
+    }
+
+    // A buffered stream that is never read still stops its source.
+    {
+        my_vector<long> input = iota_vector(100'000);
+        chunk_pool<long> pool(100);
+        chunk_stream<long> unread = buffered(counted(chunks_of(input.begin(), input.end(), pool), alive), 2);
+    }
+    assert(alive.load() == 0);
+    std::cout << "Passed!\n";
+}
+
+void run_all_chunk_pipeline_tests() {
+    std::cout << "Starting all chunk_pipeline tests...\n\n";
+
+    test_async_generator();
+    test_chunk_pool_recycling();
+    test_chunk_pipeline_stages();
+    test_chunk_pipeline_buffered();
+    test_chunk_pipeline_backpressure();
+    test_chunk_pipeline_errors();
+    test_chunk_pipeline_consumer_threads();
+    test_chunk_pipeline_early_stop();
+
+    std::cout << "\n\033[3;42;30m  All chunk_pipeline tests passed successfully!  \033[0m" << std::endl;
+}
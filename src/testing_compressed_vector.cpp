@@ -0,0 +1,155 @@
+#include "testing_compressed_vector.hpp"
+#include <algorithm>
+#include <iterator>
+
+
+void test_compressed_vector_push_back() {
+    std::cout << "Running test_compressed_vector_push_back... ";
+    compressed_vector<std::uint32_t> v = {7, 3, 9};
+    assert(v.size() == 3);
+    assert(v[0] == 7 && v[1] == 3 && v[2] == 9);
+    assert(v.back() == 9);
+    bool thrown = false;
+    try {
+        v.at(3);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Passed!\n";
+}
+
+void test_compressed_vector_sorted_ids() {
+    std::cout << "Running test_compressed_vector_sorted_ids... ";
+    my_vector<std::uint64_t> ids;
+    std::uint64_t id = 1000000000;
+    for (int i = 0; i < 10000; ++i) {
+        id += 1 + (i * 7) % 13;
+        ids.push_back(id);
+    }
+    compressed_vector<std::uint64_t> packed(ids);
+    assert(packed.size() == ids.size());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        assert(packed[i] == ids[i]);
+    }
+    assert(packed.memory_usage() * 8 < ids.size() * sizeof(std::uint64_t));
+    std::cout << "Passed!\n";
+}
+
+void test_compressed_vector_unsorted_values() {
+    std::cout << "Running test_compressed_vector_unsorted_values... ";
+    my_vector<std::uint32_t> values;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        values.push_back(50000 + (i * 2654435761u) % 1000);
+    }
+    compressed_vector<std::uint32_t> packed(values.begin(), values.end());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(packed[i] == values[i]);
+    }
+    assert(packed.memory_usage() * 2 < values.size() * sizeof(std::uint32_t));
+    std::cout << "Passed!\n";
+}
+
+void test_compressed_vector_full_width() {
+    std::cout << "Running test_compressed_vector_full_width... ";
+    compressed_vector<std::uint64_t> packed;
+    for (int i = 0; i < 300; ++i) {
+        packed.push_back(i % 2 == 0 ? ~std::uint64_t(0) - i : std::uint64_t(i));
+    }
+    for (int i = 0; i < 300; ++i) {
+        assert(packed[i] == (i % 2 == 0 ? ~std::uint64_t(0) - i : std::uint64_t(i)));
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_compressed_vector_sequential_decode() {
+    std::cout << "Running test_compressed_vector_sequential_decode... ";
+    compressed_vector<std::uint32_t> packed;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        packed.push_back(i * 3);
+    }
+    my_vector<std::uint32_t> decoded = packed.to_vector();
+    assert(decoded.size() == 1000);
+    std::uint64_t sum = 0;
+    std::uint32_t expected = 0;
+    packed.for_each([&](std::uint32_t value) {
+        assert(value == expected);
+        expected += 3;
+        sum += value;
+    });
+    assert(sum == 3u * 999 * 1000 / 2);
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        assert(decoded[i] == i * 3);
+    }
+    assert(std::equal(packed.begin(), packed.end(), decoded.begin()));
+    std::cout << "Passed!\n";
+}
+
+void test_compressed_vector_iterator() {
+    std::cout << "Running test_compressed_vector_iterator... ";
+    static_assert(std::random_access_iterator<compressed_vector<std::uint32_t>::const_iterator>);
+    compressed_vector<std::uint32_t> packed;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        packed.push_back(i % 300 == 0 ? 7 : i * 5);
+    }
+    // Reverse traversal and jumps across blocks re-decode as needed.
+    auto it = packed.end();
+    for (std::uint32_t i = 1000; i-- > 0;) {
+        --it;
+        assert(*it == packed[i]);
+    }
+    auto first = packed.begin();
+    auto copy = first + 300;
+    assert(*first == 7 && *copy == 7 && *(copy + 1) == 301 * 5);
+    assert(*first == 7 && first[999] == 999 * 5);
+    // Copies decode their own block; assigning keeps a usable buffer.
+    auto moved = 2 + first;
+    copy = moved;
+    assert(*moved == 10 && *copy == 10 && *(copy + 500) == 502 * 5);
+    assert(std::ranges::count(packed, 7u) == 4);
+
+    compressed_vector<std::uint64_t> constant(my_vector<std::uint64_t>(500, 42));
+    for (auto value : constant) {
+        assert(value == 42);
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_compressed_vector_large_append() {
+    std::cout << "Running test_compressed_vector_large_append... ";
+    // Sealing a block must not copy all packed words, or this takes minutes.
+    const std::size_t n = 4'000'000;
+    compressed_vector<std::uint64_t> packed;
+    std::uint64_t id = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        id += 1 + (i * 7) % 13;
+        packed.push_back(id);
+    }
+    assert(packed.size() == n);
+    assert(packed.memory_usage() < n);
+
+    std::uint64_t expected = 0;
+    std::size_t i = 0;
+    bool matches = true;
+    for (std::uint64_t value : packed) {
+        expected += 1 + (i++ * 7) % 13;
+        matches = matches && value == expected;
+    }
+    assert(matches && i == n);
+    assert(packed.back() == id);
+    std::cout << "Passed!\n";
+}
+
+void run_all_compressed_vector_tests() {
+    std::cout << "Starting all compressed_vector tests...\n\n";
+
+    test_compressed_vector_push_back();
+    test_compressed_vector_sorted_ids();
+    test_compressed_vector_unsorted_values();
+    test_compressed_vector_full_width();
+    test_compressed_vector_sequential_decode();
+    test_compressed_vector_iterator();
+    test_compressed_vector_large_append();
+
+    std::cout << "\n\033[3;42;30m  All compressed_vector tests passed successfully!  \033[0m" << std::endl;
+}
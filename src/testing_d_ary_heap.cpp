@@ -0,0 +1,168 @@
+#include "testing_d_ary_heap.hpp"
+#include <random>
+#include <string>
+
+
+namespace {
+
+template <std::size_t Arity>
+void check_sorts_like_std() {
+    std::mt19937 rng(Arity);
+    my_vector<int> values;
+    d_ary_heap<int, Arity> heap;
+    for (int i = 0; i < 5000; ++i) {
+        int value = static_cast<int>(rng() % 1000);
+        values.push_back(value);
+        heap.push(value);
+    }
+    std::sort(values.begin(), values.end(), std::greater<>());
+    for (int expected : values) {
+        assert(heap.top() == expected);
+        heap.pop();
+    }
+    assert(heap.empty());
+}
+
+struct task {
+    std::size_t id;
+    int distance;
+};
+
+struct task_id {
+    std::size_t operator()(const task& t) const noexcept {
+        return t.id;
+    }
+};
+
+// Smaller distance first.
+struct task_later {
+    bool operator()(const task& lhs, const task& rhs) const noexcept {
+        return lhs.distance > rhs.distance;
+    }
+};
+
+using task_heap = d_ary_heap<task, 4, task_later, heap_position_index<task_id>>;
+
+} // namespace
+
+void test_d_ary_heap_push_pop() {
+    std::cout << "Running test_d_ary_heap_push_pop... ";
+    d_ary_heap<std::string> heap;
+    heap.push("pear");
+    heap.emplace("apple");
+    heap.push("zucchini");
+    assert(heap.size() == 3 && heap.top() == "zucchini");
+    assert(heap.extract_top() == "zucchini");
+    assert(heap.extract_top() == "pear");
+    assert(heap.top() == "apple");
+
+    d_ary_heap<int, 4, std::greater<int>> min_heap;
+    for (int value : {5, 3, 8, 1}) {
+        min_heap.push(value);
+    }
+    assert(min_heap.top() == 1);
+    std::cout << "Passed!\n";
+}
+
+void test_d_ary_heap_arities() {
+    std::cout << "Running test_d_ary_heap_arities... ";
+    check_sorts_like_std<2>();
+    check_sorts_like_std<3>();
+    check_sorts_like_std<4>();
+    check_sorts_like_std<8>();
+    check_sorts_like_std<16>();
+    std::cout << "Passed!\n";
+}
+
+void test_d_ary_heap_push_range() {
+    std::cout << "Running test_d_ary_heap_push_range... ";
+    my_vector<int> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back((i * 7919) % 1000);
+    }
+    d_ary_heap<int, 8> heap(values);
+    assert(heap.top() == 999);
+
+    // A small batch is sifted up, a large one triggers a rebuild.
+    heap.push_range(my_vector<int>({2000, -1}));
+    assert(heap.top() == 2000 && heap.size() == 1002);
+    heap.push_range(values.begin(), values.end());
+    heap.push_range(values);
+    assert(heap.size() == 3002);
+
+    int previous = heap.extract_top();
+    while (!heap.empty()) {
+        int next = heap.extract_top();
+        assert(next <= previous);
+        previous = next;
+    }
+    assert(previous == -1);
+    std::cout << "Passed!\n";
+}
+
+void test_d_ary_heap_decrease_key() {
+    std::cout << "Running test_d_ary_heap_decrease_key... ";
+    task_heap heap;
+    for (std::size_t id = 0; id < 100; ++id) {
+        heap.push({id, 1000 + static_cast<int>(id)});
+    }
+    assert(heap.contains(42) && !heap.contains(100));
+    heap.decrease_key(42, {42, 5});
+    heap.decrease_key(77, {77, 3});
+    assert(heap.find(42).distance == 5);
+    assert(heap.extract_top().id == 77);
+    assert(heap.extract_top().id == 42);
+    assert(!heap.contains(42) && heap.top().id == 0);
+
+    bool thrown = false;
+    try {
+        heap.decrease_key(42, {42, 1});
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Passed!\n";
+}
+
+void test_d_ary_heap_update_and_erase() {
+    std::cout << "Running test_d_ary_heap_update_and_erase... ";
+    std::mt19937 rng(3);
+    task_heap heap;
+    my_vector<int> distance(500);
+    for (std::size_t id = 0; id < 500; ++id) {
+        distance[id] = static_cast<int>(rng() % 10000);
+        heap.push({id, distance[id]});
+    }
+    for (int i = 0; i < 2000; ++i) {
+        std::size_t id = rng() % 500;
+        if (!heap.contains(id)) continue;
+        if (rng() % 4 == 0) {
+            heap.erase(id);
+        } else {
+            distance[id] = static_cast<int>(rng() % 10000);
+            heap.update(id, {id, distance[id]});
+        }
+    }
+    for (std::size_t pos = 0; pos < heap.size(); ++pos) {
+        assert(heap.index().position(heap.container()[pos].id) == pos);
+    }
+    int previous = -1;
+    while (!heap.empty()) {
+        task t = heap.extract_top();
+        assert(t.distance == distance[t.id] && t.distance >= previous);
+        previous = t.distance;
+    }
+    std::cout << "Passed!\n";
+}
+
+void run_all_d_ary_heap_tests() {
+    std::cout << "Starting all d_ary_heap tests...\n\n";
+
+    test_d_ary_heap_push_pop();
+    test_d_ary_heap_arities();
+    test_d_ary_heap_push_range();
+    test_d_ary_heap_decrease_key();
+    test_d_ary_heap_update_and_erase();
+
+    std::cout << "\n\033[3;42;30m  All d_ary_heap tests passed successfully!  \033[0m" << std::endl;
+}
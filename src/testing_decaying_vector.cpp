@@ -0,0 +1,176 @@
+#include "testing_decaying_vector.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+
+void test_decaying_vector_basic_operations() {
+    std::cout << "Running test_decaying_vector_basic_operations... ";
+    decaying_vector<std::string> v = {"a", "c"};
+    v.insert(v.begin() + 1, "b");
+    v.push_back("d");
+    v.erase(v.begin());
+    assert(v.size() == 3);
+    assert(v[0] == "b" && v.back() == "d");
+    decaying_vector<std::string> copy(v);
+    decaying_vector<std::string> moved(std::move(copy));
+    assert(moved.vector() == v.vector());
+    std::cout << "Passed!\n";
+}
+
+void test_decaying_vector_decays_after_burst() {
+    std::cout << "Running test_decaying_vector_decays_after_burst... ";
+    decaying_vector<int> v(capacity_decay_policy{0.25, 100, 16});
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(i);
+    }
+    std::size_t peak = v.capacity();
+    v.resize(10);
+    for (int i = 0; i < 49; ++i) {
+        v.push_back(i);
+        v.pop_back();
+    }
+    assert(v.capacity() == peak);
+    v.push_back(1);
+    assert(v.capacity() == 22);
+    v.pop_back();
+    assert(v.size() == 10 && v[9] == 9);
+    std::cout << "Passed!\n";
+}
+
+void test_decaying_vector_keeps_busy_capacity() {
+    std::cout << "Running test_decaying_vector_keeps_busy_capacity... ";
+    decaying_vector<int> v(capacity_decay_policy{0.25, 10, 16});
+    v.resize(1000);
+    std::size_t capacity = v.capacity();
+    for (int i = 0; i < 1000; ++i) {
+        v.resize(500 + i % 300);
+    }
+    assert(v.capacity() == capacity);
+    std::cout << "Passed!\n";
+}
+
+void test_trim_registry_idle_vector() {
+    std::cout << "Running test_trim_registry_idle_vector... ";
+    capacity_decay_policy policy;
+    policy.pressure_trim = true;
+    decaying_vector<int> v(policy);
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(i);
+    }
+    v.resize(10);
+    std::size_t peak = v.capacity();
+    // The vector sits idle at its peak; a trim from another thread shrinks it.
+    std::size_t released = 0;
+    std::thread([&] { released = trim_registry::global().trim_all(); }).join();
+    assert(released >= (peak - 10) * sizeof(int));
+    assert(v.capacity() == 10 && v[9] == 9);
+
+    // A locked vector is skipped.
+    v.reserve(100);
+    {
+        std::lock_guard<decaying_vector<int>> guard(v);
+        std::thread([] { trim_registry::global().trim_all(); }).join();
+        assert(v.capacity() == 100);
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_trim_registry_concurrent_trim() {
+    std::cout << "Running test_trim_registry_concurrent_trim... ";
+    capacity_decay_policy policy;
+    policy.pressure_trim = true;
+    decaying_vector<long> v(policy);
+    std::atomic<bool> done{false};
+    std::thread trimmer([&] {
+        while (!done.load()) {
+            trim_registry::global().trim_all();
+        }
+    });
+    long sum = 0;
+    for (int round = 0; round < 200; ++round) {
+        std::lock_guard<decaying_vector<long>> guard(v);
+        for (long i = 0; i < 500; ++i) {
+            v.push_back(i);
+        }
+        for (long value : v) {
+            sum += value;
+        }
+        v.clear();
+    }
+    done.store(true);
+    trimmer.join();
+    assert(sum == 200L * 499 * 500 / 2);
+    std::cout << "Passed!\n";
+}
+
+void test_trim_registry_trim_all() {
+    std::cout << "Running test_trim_registry_trim_all... ";
+    static_assert(std::is_nothrow_move_constructible_v<decaying_vector<double>>);
+    std::size_t before = trim_registry::global().enrolled();
+    capacity_decay_policy policy;
+    policy.pressure_trim = true;
+    {
+        decaying_vector<double> a(policy);
+        decaying_vector<double> b(policy);
+        decaying_vector<double> not_enrolled;
+        a.reserve(100);
+        b.reserve(200);
+        not_enrolled.reserve(300);
+        b.push_back(1.0);
+        assert(trim_registry::global().enrolled() == before + 2);
+        std::size_t released = trim_registry::global().trim_all();
+        assert(released >= 299 * sizeof(double));
+        assert(a.capacity() == 0 && b.capacity() == 1);
+        assert(not_enrolled.capacity() == 300);
+
+        // Assigning a policy moves the vector in or out of the registry.
+        not_enrolled = a;
+        assert(trim_registry::global().enrolled() == before + 3);
+        a = decaying_vector<double>();
+        assert(trim_registry::global().enrolled() == before + 2);
+
+        // Moving hands the registry slot over instead of taking a new one.
+        decaying_vector<double> c(std::move(b));
+        assert(trim_registry::global().enrolled() == before + 2);
+        assert(c.policy().pressure_trim && !b.policy().pressure_trim);
+        not_enrolled = std::move(c);
+        assert(trim_registry::global().enrolled() == before + 1);
+        b.reserve(50);
+        c.reserve(50);
+        trim_registry::global().trim_all();
+        assert(b.capacity() == 50 && c.capacity() == 50);
+    }
+    assert(trim_registry::global().enrolled() == before);
+    std::cout << "Passed!\n";
+}
+
+void test_memory_pressure_watcher() {
+    std::cout << "Running test_memory_pressure_watcher... ";
+    memory_pressure_watcher watcher;
+    assert(!watcher.start("/nonexistent/memory.pressure"));
+    assert(!watcher.running());
+    // PSI may be missing or not writable here; either outcome is fine.
+    if (watcher.start()) {
+        assert(watcher.running());
+        watcher.stop();
+    }
+    assert(!watcher.running());
+    std::cout << "Passed!\n";
+}
+
+void run_all_decaying_vector_tests() {
+    std::cout << "Starting all decaying_vector tests...\n\n";
+
+    test_decaying_vector_basic_operations();
+    test_decaying_vector_decays_after_burst();
+    test_decaying_vector_keeps_busy_capacity();
+    test_trim_registry_idle_vector();
+    test_trim_registry_concurrent_trim();
+    test_trim_registry_trim_all();
+    test_memory_pressure_watcher();
+
+    std::cout << "\n\033[3;42;30m  All decaying_vector tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,138 @@
+#include "testing_flat_containers.hpp"
+#include <string>
+#include <string_view>
+
+
+void test_flat_set_insert() {
+    std::cout << "Running test_flat_set_insert... ";
+    flat_set<int> s;
+    bool inserted_3 = s.insert(3).second;
+    bool inserted_1 = s.insert(1).second;
+    bool inserted_2 = s.insert(2).second;
+    bool inserted_again = s.insert(2).second;
+    assert(inserted_3 && inserted_1 && inserted_2);
+    assert(!inserted_again);
+    assert(s.size() == 3);
+    assert(s.sequence() == my_vector<int>({1, 2, 3}));
+    assert(s.contains(1) && !s.contains(4));
+    std::cout << "Passed!\n";
+}
+
+void test_flat_set_bulk_insert() {
+    std::cout << "Running test_flat_set_bulk_insert... ";
+    flat_set<int> s = {5, 1, 5, 3};
+    my_vector<int> more = {4, 3, 2, 2, 6};
+    s.insert(more.begin(), more.end());
+    assert(s.sequence() == my_vector<int>({1, 2, 3, 4, 5, 6}));
+    std::cout << "Passed!\n";
+}
+
+void test_flat_set_erase() {
+    std::cout << "Running test_flat_set_erase... ";
+    flat_set<int> s = {1, 2, 3, 4};
+    std::size_t erased = s.erase(2);
+    std::size_t erased_missing = s.erase(7);
+    assert(erased == 1);
+    assert(erased_missing == 0);
+    s.erase(s.find(4));
+    assert(s.sequence() == my_vector<int>({1, 3}));
+    std::cout << "Passed!\n";
+}
+
+void test_flat_set_heterogeneous_lookup() {
+    std::cout << "Running test_flat_set_heterogeneous_lookup... ";
+    flat_set<std::string, std::less<>> s = {"pear", "apple", "plum"};
+    std::string_view key = "plum";
+    assert(s.contains(key));
+    assert(s.find(key) == s.begin() + 2);
+    assert(!s.contains(std::string_view("fig")));
+    std::cout << "Passed!\n";
+}
+
+void test_flat_set_search_index() {
+    std::cout << "Running test_flat_set_search_index... ";
+    my_vector<int> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i * 2);
+    }
+    flat_set<int> s(values.begin(), values.end());
+    s.build_search_index();
+    assert(s.has_search_index());
+    for (int i = -1; i < 2001; ++i) {
+        auto expected = std::lower_bound(s.sequence().begin(), s.sequence().end(), i);
+        assert(s.lower_bound(i) == expected);
+        assert(s.contains(i) == (i >= 0 && i < 2000 && i % 2 == 0));
+    }
+    s.insert(1);
+    assert(!s.has_search_index());
+    assert(s.contains(1));
+    std::cout << "Passed!\n";
+}
+
+void test_flat_map_access() {
+    std::cout << "Running test_flat_map_access... ";
+    flat_map<std::string, int> m;
+    m["two"] = 2;
+    m["one"] = 1;
+    m["two"] += 20;
+    assert(m.size() == 2);
+    assert(m.at("two") == 22);
+    assert(m.begin()->first == "one");
+    bool emplaced = m.try_emplace("one", 100).second;
+    assert(!emplaced);
+    assert(m.at("one") == 1);
+    m.insert_or_assign("one", 100);
+    assert(m.at("one") == 100);
+    bool thrown = false;
+    try {
+        m.at("three");
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Passed!\n";
+}
+
+void test_flat_map_bulk_insert() {
+    std::cout << "Running test_flat_map_bulk_insert... ";
+    flat_map<int, char> m = {{3, 'c'}, {1, 'a'}};
+    m.insert({{2, 'b'}, {3, 'x'}, {2, 'y'}});
+    assert(m.size() == 3);
+    assert(m.at(1) == 'a');
+    assert(m.at(2) == 'b');
+    assert(m.at(3) == 'c');
+    std::cout << "Passed!\n";
+}
+
+void test_flat_map_search_index() {
+    std::cout << "Running test_flat_map_search_index... ";
+    flat_map<int, int> m;
+    for (int i = 0; i < 100; ++i) {
+        m[i * 3] = i;
+    }
+    m.build_search_index();
+    for (int i = 0; i < 300; ++i) {
+        auto it = m.find(i);
+        if (i % 3 == 0) {
+            assert(it != m.end() && it->second == i / 3);
+        } else {
+            assert(it == m.end());
+        }
+    }
+    std::cout << "Passed!\n";
+}
+
+void run_all_flat_container_tests() {
+    std::cout << "Starting all flat container tests...\n\n";
+
+    test_flat_set_insert();
+    test_flat_set_bulk_insert();
+    test_flat_set_erase();
+    test_flat_set_heterogeneous_lookup();
+    test_flat_set_search_index();
+    test_flat_map_access();
+    test_flat_map_bulk_insert();
+    test_flat_map_search_index();
+
+    std::cout << "\n\033[3;42;30m  All flat container tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,323 @@
+#include "testing_flat_hash_map.hpp"
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+void test_flat_hash_set_insert() {
+    std::cout << "Running test_flat_hash_set_insert... ";
+    flat_hash_set<int> s;
+    assert(s.empty() && s.find(1) == s.end());
+    bool inserted_3 = s.insert(3).second;
+    bool inserted_1 = s.insert(1).second;
+    bool inserted_again = s.insert(3).second;
+    bool emplaced_2 = s.emplace(2).second;
+    assert(inserted_3 && inserted_1 && !inserted_again && emplaced_2);
+    assert(s.size() == 3);
+    assert(s.contains(1) && s.contains(2) && s.contains(3) && !s.contains(4));
+    assert(s.count(2) == 1 && s.count(5) == 0);
+
+    int sum = 0;
+    for (int key : s) {
+        sum += key;
+    }
+    assert(sum == 6);
+    std::cout << "Passed!\n";
+}
+
+void test_flat_hash_set_erase() {
+    std::cout << "Running test_flat_hash_set_erase... ";
+    flat_hash_set<int> s;
+    for (int i = 0; i < 1000; ++i) {
+        s.insert(i);
+    }
+    for (int i = 0; i < 1000; i += 2) {
+        std::size_t erased = s.erase(i);
+        assert(erased == 1);
+    }
+    std::size_t erased_again = s.erase(0);
+    assert(erased_again == 0);
+    s.erase(s.find(1));
+    assert(s.size() == 499);
+    for (int i = 0; i < 1000; ++i) {
+        assert(s.contains(i) == (i % 2 == 1 && i != 1));
+    }
+
+    // Churn on a small set must reuse deleted slots instead of growing.
+    std::size_t buckets = s.bucket_count();
+    for (int i = 0; i < 100000; ++i) {
+        s.insert(2000 + i);
+        s.erase(2000 + i);
+    }
+    assert(s.bucket_count() == buckets);
+    assert(s.size() == 499);
+
+    s.clear();
+    assert(s.empty() && !s.contains(3));
+    std::cout << "Passed!\n";
+}
+
+void test_flat_hash_set_rehash() {
+    std::cout << "Running test_flat_hash_set_rehash... ";
+    flat_hash_set<int> s;
+    s.reserve(1000);
+    std::size_t buckets = s.bucket_count();
+    assert(buckets >= 1000 && (buckets & (buckets - 1)) == 0);
+    for (int i = 0; i < 1000; ++i) {
+        s.insert(i * 7);
+    }
+    assert(s.bucket_count() == buckets);
+    assert(s.load_factor() <= 7.0 / 8.0);
+
+    s.rehash(8192);
+    assert(s.bucket_count() == 8192);
+    for (int i = 0; i < 1000; ++i) {
+        assert(s.contains(i * 7));
+    }
+    s.rehash(0);
+    assert(s.bucket_count() < 8192 && s.size() == 1000);
+    assert(s.contains(6993) && !s.contains(6994));
+    std::cout << "Passed!\n";
+}
+
+void test_flat_hash_map_access() {
+    std::cout << "Running test_flat_hash_map_access... ";
+    flat_hash_map<std::string, int> m;
+    m["two"] = 2;
+    m["one"] = 1;
+    m["two"] += 20;
+    assert(m.size() == 2);
+    assert(m.at("two") == 22);
+    bool emplaced = m.try_emplace("one", 100).second;
+    assert(!emplaced);
+    assert(m.at("one") == 1);
+    m.insert_or_assign("one", 100);
+    assert(m.at("one") == 100);
+    bool inserted = m.insert({"three", 3}).second;
+    assert(inserted);
+    assert(m.find("three")->second == 3);
+
+    bool thrown = false;
+    try {
+        m.at("four");
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // Move-only mapped values are constructed in place.
+    flat_hash_map<int, std::unique_ptr<int>> owners;
+    owners.try_emplace(1, std::make_unique<int>(10));
+    for (int i = 2; i < 100; ++i) {
+        owners[i] = std::make_unique<int>(i * 10);
+    }
+    assert(*owners.at(1) == 10 && *owners.at(99) == 990);
+    std::cout << "Passed!\n";
+}
+
+namespace {
+
+struct string_hash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view s) const noexcept {
+        return std::hash<std::string_view>()(s);
+    }
+};
+
+// Key that counts how often it is made from an int.
+struct counted_key {
+    static inline int conversions = 0;
+    int id;
+
+    counted_key(int value) : id(value) {
+        ++conversions;
+    }
+
+    bool operator==(const counted_key&) const = default;
+};
+
+// Sends every key to the same probe sequence, so each lookup compares with
+// every element.
+struct same_hash {
+    std::size_t operator()(const counted_key&) const noexcept {
+        return 0;
+    }
+};
+
+} // namespace
+
+void test_flat_hash_map_heterogeneous_lookup() {
+    std::cout << "Running test_flat_hash_map_heterogeneous_lookup... ";
+    flat_hash_map<std::string, int, string_hash, std::equal_to<>> m;
+    m["pear"] = 1;
+    m["plum"] = 2;
+    std::string_view key = "plum";
+    assert(m.contains(key));
+    assert(m.find(key)->second == 2);
+    assert(!m.contains(std::string_view("fig")));
+
+    // Without a transparent hash, try_emplace converts the key only once.
+    flat_hash_map<counted_key, int, same_hash> counted;
+    for (int i = 0; i < 20; ++i) {
+        counted.try_emplace(i, i);
+        counted.insert_or_assign(i, -i);
+    }
+    assert(counted_key::conversions == 40 && counted.size() == 20);
+    std::cout << "Passed!\n";
+}
+
+void test_flat_hash_map_copy_and_move() {
+    std::cout << "Running test_flat_hash_map_copy_and_move... ";
+    flat_hash_map<int, std::string> m;
+    for (int i = 0; i < 100; ++i) {
+        m[i] = std::to_string(i);
+    }
+    flat_hash_map<int, std::string> copy(m);
+    assert(copy.size() == 100 && copy.at(42) == "42");
+    copy[42] = "changed";
+    assert(m.at(42) == "42");
+
+    flat_hash_map<int, std::string> moved(std::move(copy));
+    assert(moved.size() == 100 && moved.at(42) == "changed");
+    assert(copy.empty() && !copy.contains(42));
+
+    copy = moved;
+    assert(copy.size() == 100);
+    swap(copy, m);
+    assert(copy.at(42) == "42" && m.at(42) == "changed");
+    std::cout << "Passed!\n";
+}
+
+void test_flat_hash_map_against_std() {
+    std::cout << "Running test_flat_hash_map_against_std... ";
+    std::mt19937 rng(7);
+    flat_hash_map<unsigned, unsigned> m;
+    std::unordered_map<unsigned, unsigned> expected;
+    for (int i = 0; i < 200000; ++i) {
+        unsigned key = rng() % 5000;
+        switch (rng() % 3) {
+            case 0:
+                m[key] = i;
+                expected[key] = i;
+                break;
+            case 1: {
+                std::size_t erased = m.erase(key);
+                assert(erased == expected.erase(key));
+                break;
+            }
+            default:
+                assert(m.contains(key) == expected.contains(key));
+                if (m.contains(key)) {
+                    assert(m.at(key) == expected.at(key));
+                }
+        }
+    }
+    assert(m.size() == expected.size());
+    std::size_t visited = 0;
+    for (const auto& [key, value] : m) {
+        assert(expected.at(key) == value);
+        ++visited;
+    }
+    assert(visited == expected.size());
+    std::cout << "Passed!\n";
+}
+
+void test_flat_hash_map_aliasing_insert() {
+    std::cout << "Running test_flat_hash_map_aliasing_insert... ";
+    flat_hash_map<std::string, std::string> m;
+    m.emplace("0", std::string(100, 'x'));
+    // Each insert that grows the table copies from an element it moves.
+    for (int i = 1; i < 200; ++i) {
+        const std::string& first = m.at("0");
+        m.try_emplace(std::to_string(i), first);
+    }
+    for (int i = 0; i < 200; ++i) {
+        assert(m.at(std::to_string(i)) == std::string(100, 'x'));
+    }
+
+    flat_hash_set<std::string> s;
+    s.insert(std::string(50, 'a'));
+    for (int i = 0; i < 200; ++i) {
+        const std::string& any = *s.begin();
+        s.insert(any + std::to_string(i));
+    }
+    assert(s.size() == 201);
+    std::cout << "Passed!\n";
+}
+
+namespace {
+
+// Value whose copies throw once armed. Its move is not noexcept, so the table
+// copies it when rehashing.
+struct fragile {
+    static inline int live = 0;
+    static inline int copies_left = -1;
+    int value;
+
+    explicit fragile(int v) : value(v) {
+        ++live;
+    }
+
+    fragile(const fragile& other) : value(other.value) {
+        if (copies_left == 0) throw std::runtime_error("copy failed");
+        if (copies_left > 0) --copies_left;
+        ++live;
+    }
+
+    fragile(fragile&& other) : fragile(static_cast<const fragile&>(other)) {}
+
+    ~fragile() {
+        --live;
+    }
+};
+
+} // namespace
+
+void test_flat_hash_map_rehash_failure() {
+    std::cout << "Running test_flat_hash_map_rehash_failure... ";
+    {
+        flat_hash_map<int, fragile> m;
+        for (int i = 0; i < 200; ++i) {
+            m.try_emplace(i, i);
+        }
+        // The next rehash copies all elements and fails halfway through.
+        fragile::copies_left = 100;
+        std::size_t buckets = m.bucket_count();
+        bool thrown = false;
+        try {
+            for (int i = 200; i < 1000; ++i) {
+                m.try_emplace(i, i);
+            }
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        fragile::copies_left = -1;
+        assert(thrown && m.bucket_count() == buckets);
+        for (int i = 0; i < static_cast<int>(m.size()); ++i) {
+            assert(m.at(i).value == i);
+        }
+        assert(fragile::live == static_cast<int>(m.size()));
+    }
+    assert(fragile::live == 0);
+    std::cout << "Passed!\n";
+}
+
+void run_all_flat_hash_map_tests() {
+    std::cout << "Starting all flat hash map tests...\n\n";
+
+    test_flat_hash_set_insert();
+    test_flat_hash_set_erase();
+    test_flat_hash_set_rehash();
+    test_flat_hash_map_access();
+    test_flat_hash_map_heterogeneous_lookup();
+    test_flat_hash_map_copy_and_move();
+    test_flat_hash_map_against_std();
+    test_flat_hash_map_aliasing_insert();
+    test_flat_hash_map_rehash_failure();
+
+    std::cout << "\n\033[3;42;30m  All flat hash map tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,162 @@
+#include "testing_gap_buffer.hpp"
+#include <random>
+#include <string>
+
+
+void test_gap_buffer_push_and_access() {
+    std::cout << "Running test_gap_buffer_push_and_access... ";
+    gap_buffer<int> b;
+    assert(b.empty() && b.begin() == b.end());
+    for (int i = 0; i < 10; ++i) {
+        b.push_back(i);
+    }
+    assert(b.size() == 10 && b.front() == 0 && b.back() == 9);
+    assert(b.at(3) == 3);
+    bool thrown = false;
+    try {
+        b.at(10);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    b.pop_back();
+    assert(b.size() == 9 && b.back() == 8);
+    assert(std::equal(b.rbegin(), b.rend(), my_vector<int>({8, 7, 6, 5, 4, 3, 2, 1, 0}).begin()));
+    std::cout << "Passed!\n";
+}
+
+void test_gap_buffer_cursor_edits() {
+    std::cout << "Running test_gap_buffer_cursor_edits... ";
+    gap_buffer<char> text = {'h', 'e', 'l', 'o'};
+    text.insert(text.begin() + 3, 'l');
+    assert(text.cursor() == 4);
+    text.move_cursor(text.size());
+    // Typing at the cursor only fills the gap.
+    for (char c : std::string(", world")) {
+        text.insert(text.begin() + text.cursor(), c);
+    }
+    std::size_t capacity = text.capacity();
+    text.erase(text.begin() + text.cursor() - 1);
+    text.insert(text.begin() + text.cursor(), 'D');
+    assert(text.capacity() == capacity);
+    assert(std::string(text.begin(), text.end()) == "hello, worlD");
+
+    text.move_cursor(0);
+    assert(text.cursor() == 0);
+    text.insert(text.begin(), '>');
+    assert(std::string(text.begin(), text.end()) == ">hello, worlD");
+    std::cout << "Passed!\n";
+}
+
+void test_gap_buffer_range_insert_and_erase() {
+    std::cout << "Running test_gap_buffer_range_insert_and_erase... ";
+    gap_buffer<int> b = {1, 2, 6};
+    my_vector<int> middle = {3, 4, 5};
+    auto it = b.insert(b.begin() + 2, middle.begin(), middle.end());
+    assert(*it == 3);
+    b.insert(b.begin(), 2, 0);
+    assert(b.to_vector() == my_vector<int>({0, 0, 1, 2, 3, 4, 5, 6}));
+    it = b.erase(b.begin() + 1, b.begin() + 4);
+    assert(*it == 3);
+    assert(b.to_vector() == my_vector<int>({0, 3, 4, 5, 6}));
+    b.insert(b.end(), {7, 8});
+    assert(b.to_vector() == my_vector<int>({0, 3, 4, 5, 6, 7, 8}));
+
+    // Inserting an element of the buffer itself while the gap moves past it.
+    b.move_cursor(b.size());
+    b.insert(b.begin(), b[3]);
+    assert(b.front() == 5);
+    std::cout << "Passed!\n";
+}
+
+void test_gap_buffer_contiguous_view() {
+    std::cout << "Running test_gap_buffer_contiguous_view... ";
+    gap_buffer<int> b = {1, 2, 3, 4};
+    b.insert(b.begin() + 1, 10);
+    const int* data = b.data();
+    assert(b.cursor() == b.size());
+    my_vector<int> expected = {1, 10, 2, 3, 4};
+    assert(std::equal(data, data + b.size(), expected.begin()));
+    std::cout << "Passed!\n";
+}
+
+void test_gap_buffer_non_trivial_elements() {
+    std::cout << "Running test_gap_buffer_non_trivial_elements... ";
+    gap_buffer<std::string> lines;
+    for (int i = 0; i < 50; ++i) {
+        lines.emplace(lines.begin() + lines.size() / 2, std::string(20, static_cast<char>('a' + i % 26)));
+    }
+    lines.move_cursor(3);
+    lines.move_cursor(40);
+    lines.erase(lines.begin() + 10, lines.begin() + 20);
+    assert(lines.size() == 40);
+
+    gap_buffer<std::string> copy(lines);
+    assert(copy == lines);
+    copy.front() = "changed";
+    assert(copy != lines);
+    gap_buffer<std::string> moved(std::move(copy));
+    assert(moved.front() == "changed" && copy.empty());
+    lines.shrink_to_fit();
+    assert(lines.capacity() == lines.size());
+    lines.clear();
+    assert(lines.empty());
+    std::cout << "Passed!\n";
+}
+
+void test_gap_buffer_against_my_vector() {
+    std::cout << "Running test_gap_buffer_against_my_vector... ";
+    std::mt19937 rng(11);
+    gap_buffer<int> b;
+    my_vector<int> expected;
+    std::size_t cursor = 0;
+    for (int i = 0; i < 20000; ++i) {
+        // Edits mostly stay near the previous one, with occasional jumps.
+        if (rng() % 50 == 0) {
+            cursor = expected.empty() ? 0 : rng() % (expected.size() + 1);
+        }
+        cursor = std::min(cursor, expected.size());
+        if (rng() % 3 != 0 || expected.empty()) {
+            b.insert(b.begin() + cursor, i);
+            expected.insert(expected.begin() + cursor, i);
+            ++cursor;
+        } else if (cursor > 0) {
+            --cursor;
+            b.erase(b.begin() + cursor);
+            expected.erase(expected.begin() + cursor);
+        }
+    }
+    assert(b.to_vector() == expected);
+    std::cout << "Passed!\n";
+}
+
+void test_gap_buffer_aliasing_emplace() {
+    std::cout << "Running test_gap_buffer_aliasing_emplace... ";
+    gap_buffer<std::string> lines;
+    lines.emplace_back(30, 'x');
+    // Each call copies an element that growing or moving the gap relocates.
+    for (int i = 0; i < 100; ++i) {
+        lines.emplace(lines.begin(), lines.back());
+        lines.emplace_back(lines.front());
+        lines.insert(lines.begin() + lines.size() / 2, lines[lines.size() - 1]);
+    }
+    assert(lines.size() == 301);
+    for (const std::string& line : lines) {
+        assert(line == std::string(30, 'x'));
+    }
+    std::cout << "Passed!\n";
+}
+
+void run_all_gap_buffer_tests() {
+    std::cout << "Starting all gap_buffer tests...\n\n";
+
+    test_gap_buffer_push_and_access();
+    test_gap_buffer_cursor_edits();
+    test_gap_buffer_range_insert_and_erase();
+    test_gap_buffer_contiguous_view();
+    test_gap_buffer_non_trivial_elements();
+    test_gap_buffer_against_my_vector();
+    test_gap_buffer_aliasing_emplace();
+
+    std::cout << "\n\033[3;42;30m  All gap_buffer tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,155 @@
+#include "testing_inplace_vector.hpp"
+#include <string>
+
+
+void test_inplace_vector_push_and_access() {
+    std::cout << "Running test_inplace_vector_push_and_access... ";
+    inplace_vector<int, 8> v;
+    assert(v.empty() && v.capacity() == 8);
+    v.push_back(1);
+    v.emplace_back(2);
+    v.push_back(3);
+    assert(v.size() == 3 && v.front() == 1 && v.back() == 3);
+    assert(v.at(1) == 2 && v[2] == 3);
+    bool thrown = false;
+    try {
+        v.at(3);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    v.pop_back();
+    assert(v == (inplace_vector<int, 8>{1, 2}));
+    v.resize(5, 7);
+    assert(v == (inplace_vector<int, 8>{1, 2, 7, 7, 7}));
+    v.resize(1);
+    assert(v.size() == 1 && v.back() == 1);
+    std::cout << "Passed!\n";
+}
+
+void test_inplace_vector_capacity_limit() {
+    std::cout << "Running test_inplace_vector_capacity_limit... ";
+    inplace_vector<int, 3> v = {1, 2, 3};
+    assert(v.full());
+    int* pushed = v.try_push_back(4);
+    int* emplaced = v.try_emplace(v.begin(), 0);
+    assert(pushed == nullptr && emplaced == nullptr);
+    assert(v.size() == 3);
+
+    bool thrown = false;
+    try {
+        v.push_back(4);
+    } catch (const std::length_error&) {
+        thrown = true;
+    }
+    assert(thrown && v.size() == 3);
+
+    thrown = false;
+    try {
+        inplace_vector<int, 3> too_many = {1, 2, 3, 4};
+    } catch (const std::length_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    v.pop_back();
+    int* added = v.try_push_back(9);
+    assert(added == &v.back() && *added == 9);
+    std::cout << "Passed!\n";
+}
+
+void test_inplace_vector_insert_and_erase() {
+    std::cout << "Running test_inplace_vector_insert_and_erase... ";
+    inplace_vector<int, 10> v = {1, 5};
+    auto it = v.insert(v.begin() + 1, {2, 3});
+    assert(*it == 2);
+    v.emplace(v.begin() + 3, 4);
+    v.insert(v.begin(), 2, 0);
+    assert(v == (inplace_vector<int, 10>{0, 0, 1, 2, 3, 4, 5}));
+    it = v.erase(v.begin(), v.begin() + 2);
+    assert(*it == 1);
+    v.erase(v.end() - 1);
+    assert(v == (inplace_vector<int, 10>{1, 2, 3, 4}));
+    int* emplaced = v.try_emplace(v.begin() + 2, 10);
+    assert(emplaced != nullptr && *emplaced == 10);
+    assert(v == (inplace_vector<int, 10>{1, 2, 10, 3, 4}));
+    std::cout << "Passed!\n";
+}
+
+void test_inplace_vector_trivial_copies() {
+    std::cout << "Running test_inplace_vector_trivial_copies... ";
+    static_assert(std::is_trivially_copyable_v<inplace_vector<int, 16>>);
+    static_assert(std::is_trivially_destructible_v<inplace_vector<double, 4>>);
+    static_assert(!std::is_trivially_copyable_v<inplace_vector<std::string, 4>>);
+
+    inplace_vector<int, 16> a = {1, 2, 3};
+    inplace_vector<int, 16> b = a;
+    b.push_back(4);
+    assert(a.size() == 3 && b.size() == 4);
+    a = b;
+    assert(a == b);
+    std::cout << "Passed!\n";
+}
+
+namespace {
+
+struct tracked {
+    static int live;
+    int value;
+
+    tracked(int v) : value(v) { ++live; }
+    tracked(const tracked& other) : value(other.value) { ++live; }
+    tracked(tracked&& other) noexcept : value(other.value) { ++live; }
+    tracked& operator=(const tracked&) = default;
+    tracked& operator=(tracked&&) noexcept = default;
+    ~tracked() { --live; }
+
+    bool operator==(const tracked& other) const { return value == other.value; }
+};
+
+int tracked::live = 0;
+
+} // namespace
+
+void test_inplace_vector_element_lifetimes() {
+    std::cout << "Running test_inplace_vector_element_lifetimes... ";
+    {
+        inplace_vector<tracked, 8> a;
+        for (int i = 0; i < 5; ++i) {
+            a.emplace_back(i);
+        }
+        assert(tracked::live == 5);
+        a.erase(a.begin() + 1, a.begin() + 3);
+        assert(tracked::live == 3);
+
+        inplace_vector<tracked, 8> b = {tracked(7)};
+        assert(tracked::live == 4);
+        swap(a, b);
+        assert(a.size() == 1 && b.size() == 3 && a.front().value == 7);
+        assert(tracked::live == 4);
+
+        inplace_vector<tracked, 8> c(std::move(b));
+        a = c;
+        assert(a == c && tracked::live == 9);
+        a.clear();
+        assert(tracked::live == 6);
+    }
+    assert(tracked::live == 0);
+
+    inplace_vector<std::string, 4> words = {"alpha", "beta"};
+    words.insert(words.begin(), "zero");
+    assert(words.front() == "zero" && words.back() == "beta");
+    std::cout << "Passed!\n";
+}
+
+void run_all_inplace_vector_tests() {
+    std::cout << "Starting all inplace_vector tests...\n\n";
+
+    test_inplace_vector_push_and_access();
+    test_inplace_vector_capacity_limit();
+    test_inplace_vector_insert_and_erase();
+    test_inplace_vector_trivial_copies();
+    test_inplace_vector_element_lifetimes();
+
+    std::cout << "\n\033[3;42;30m  All inplace_vector tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,56 @@
+#include "testing_numa_placement.hpp"
+#include <string>
+
+
+void test_numa_node_count() {
+    std::cout << "Running test_numa_node_count... ";
+    assert(numa_node_count() >= 1);
+    if (numa_node_count() == 1) {
+        my_vector<int> v(100000, 0);
+        assert(!numa_bind(v.data(), v.size() * sizeof(int), numa_policy::interleaved));
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_numa_node_list() {
+    std::cout << "Running test_numa_node_list... ";
+    assert(detail::parse_numa_node_list("0") == 0b1);
+    assert(detail::parse_numa_node_list("0-1,3") == 0b1011);
+    // Sparse layouts keep their gaps: node 1 has no memory here.
+    assert(detail::parse_numa_node_list("0,2") == 0b101);
+    assert(detail::parse_numa_node_list("1") == 0b10);
+    assert(detail::parse_numa_node_list("2-4,6-7") == 0b11011100);
+    assert(detail::parse_numa_node_list("") == 0);
+    std::cout << "Passed!\n";
+}
+
+void test_make_numa_vector() {
+    std::cout << "Running test_make_numa_vector... ";
+    for (numa_policy policy : {numa_policy::local, numa_policy::interleaved, numa_policy::partitioned}) {
+        my_vector<double> v = make_numa_vector(1 << 20, 2.5, policy);
+        assert(v.size() == (1 << 20));
+        assert(std::all_of(v.begin(), v.end(), [](double x) { return x == 2.5; }));
+    }
+    my_vector<int> empty = make_numa_vector(0, 1, numa_policy::partitioned);
+    assert(empty.empty());
+    std::cout << "Passed!\n";
+}
+
+void test_numa_thread_policy() {
+    std::cout << "Running test_numa_thread_policy... ";
+    numa_thread_policy guard(numa_policy::interleaved);
+    my_vector<std::string> v(1000, "interleaved");
+    assert(v.size() == 1000 && v.back() == "interleaved");
+    std::cout << "Passed!\n";
+}
+
+void run_all_numa_placement_tests() {
+    std::cout << "Starting all NUMA placement tests...\n\n";
+
+    test_numa_node_count();
+    test_numa_node_list();
+    test_make_numa_vector();
+    test_numa_thread_policy();
+
+    std::cout << "\n\033[3;42;30m  All NUMA placement tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,122 @@
+#include "testing_parallel_algorithms.hpp"
+#include <stdexcept>
+#include <string>
+
+
+void test_parallel_for_each() {
+    std::cout << "Running test_parallel_for_each... ";
+    my_vector<int> v(100000, 1);
+    parallel_for_each(v, [](int& x) { x *= 3; });
+    assert(std::all_of(v.begin(), v.end(), [](int x) { return x == 3; }));
+
+    parallel_for_each(v.begin() + 10, v.begin() + 20, [](int& x) { x = 0; });
+    assert(v[9] == 3 && v[10] == 0 && v[19] == 0 && v[20] == 3);
+    std::cout << "Passed!\n";
+}
+
+void test_parallel_transform() {
+    std::cout << "Running test_parallel_transform... ";
+    my_array<int, 5000> arr{};
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        arr[i] = static_cast<int>(i);
+    }
+    my_vector<long> out(arr.size());
+    parallel_transform(arr, out.begin(), [](int x) { return static_cast<long>(x) * x; });
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        assert(out[i] == static_cast<long>(i) * static_cast<long>(i));
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_parallel_reduce() {
+    std::cout << "Running test_parallel_reduce... ";
+    my_vector<long> v;
+    for (long i = 1; i <= 1000000; ++i) {
+        v.push_back(i);
+    }
+    assert(parallel_reduce(v, 0L) == 1000000L * 1000001L / 2);
+    assert(parallel_reduce(v.begin(), v.end(), 0L, [](long a, long b) { return std::max(a, b); }) == 1000000);
+    // Three iterator arguments pick the iterator overload with std::plus.
+    assert(parallel_reduce(v.begin(), v.begin() + 100, 0L) == 5050);
+
+    my_vector<std::string> words(10000, "ab");
+    assert(parallel_reduce(words, std::string()).size() == 20000);
+    my_vector<int> empty;
+    assert(parallel_reduce(empty, 7) == 7);
+    std::cout << "Passed!\n";
+}
+
+void test_parallel_count_if() {
+    std::cout << "Running test_parallel_count_if... ";
+    my_vector<int> v;
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(i);
+    }
+    assert(parallel_count_if(v, [](int x) { return x % 3 == 0; }) == 33334);
+    std::cout << "Passed!\n";
+}
+
+void test_parallel_scans() {
+    std::cout << "Running test_parallel_scans... ";
+    my_vector<long> v(123457, 2);
+    my_vector<long> inclusive(v.size());
+    my_vector<long> exclusive(v.size());
+    parallel_inclusive_scan(v, inclusive.begin());
+    parallel_exclusive_scan(v, exclusive.begin(), 10L);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        assert(inclusive[i] == 2 * static_cast<long>(i + 1));
+        assert(exclusive[i] == 10 + 2 * static_cast<long>(i));
+    }
+
+    my_vector<long> by_iterators(v.size());
+    parallel_exclusive_scan(v.begin(), v.end(), by_iterators.begin(), 10L);
+    assert(by_iterators == exclusive);
+    parallel_inclusive_scan(v.begin(), v.end(), v.begin());
+    assert(v == inclusive);
+    std::cout << "Passed!\n";
+}
+
+void test_parallel_partition() {
+    std::cout << "Running test_parallel_partition... ";
+    my_vector<int> v;
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(i);
+    }
+    auto middle = parallel_partition(v, [](int x) { return x % 2 == 0; });
+    assert(middle - v.begin() == 50000);
+    for (int i = 0; i < 50000; ++i) {
+        assert(v[i] == 2 * i);
+        assert(v[50000 + i] == 2 * i + 1);
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_parallel_exceptions() {
+    std::cout << "Running test_parallel_exceptions... ";
+    my_vector<int> v(100000, 0);
+    v[77777] = 1;
+    bool thrown = false;
+    try {
+        parallel_for_each(v, [](int x) {
+            if (x == 1) throw std::runtime_error("bad element");
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Passed!\n";
+}
+
+void run_all_parallel_algorithm_tests() {
+    std::cout << "Starting all parallel algorithm tests...\n\n";
+
+    test_parallel_for_each();
+    test_parallel_transform();
+    test_parallel_reduce();
+    test_parallel_count_if();
+    test_parallel_scans();
+    test_parallel_partition();
+    test_parallel_exceptions();
+
+    std::cout << "\n\033[3;42;30m  All parallel algorithm tests passed successfully!  \033[0m" << std::endl;
+}
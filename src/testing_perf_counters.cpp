@@ -0,0 +1,57 @@
+#include "testing_perf_counters.hpp"
+#include <chrono>
+#include <string>
+#include <thread>
+#include "my_vector.hpp"
+
+
+namespace {
+
+void touch_memory() {
+    my_vector<int> values(1 << 20, 1);
+    do_not_optimize(values.data());
+}
+
+} // namespace
+
+void test_perf_counters_measure() {
+    std::cout << "Running test_perf_counters_measure... ";
+    perf_counters counters;
+    counters.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    touch_memory();
+    perf_counters::sample result = counters.stop();
+    assert(result.wall_ns >= 2e6);
+    for (std::size_t e = 0; e < perf_counters::event_count; ++e) {
+        auto event = static_cast<perf_counters::event>(e);
+        // Whatever the kernel allows, a counter is only reported if it opened.
+        assert(!result.valid[e] || counters.available(event));
+        assert(perf_counters::event_name(event) != std::string("unknown"));
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_perf_counters_fallback() {
+    std::cout << "Running test_perf_counters_fallback... ";
+    perf_counters counters(false);
+    counters.start();
+    touch_memory();
+    perf_counters::sample result = counters.stop();
+    assert(result.wall_ns > 0);
+    assert(!result.valid[perf_counters::cycles] && !result.valid[perf_counters::instructions]);
+    assert(!counters.available(perf_counters::cycles));
+#if defined(__linux__)
+    // Page faults still come from getrusage.
+    assert(result.valid[perf_counters::page_faults] && result.values[perf_counters::page_faults] > 0);
+#endif
+    std::cout << "Passed!\n";
+}
+
+void run_all_perf_counter_tests() {
+    std::cout << "Starting all perf counter tests...\n\n";
+
+    test_perf_counters_measure();
+    test_perf_counters_fallback();
+
+    std::cout << "\n\033[3;42;30m  All perf counter tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,212 @@
+#include "testing_persistent_vector.hpp"
+#include <random>
+#include <string>
+#include <type_traits>
+
+
+namespace {
+
+my_vector<int> iota_vector(int first, int count) {
+    my_vector<int> v;
+    for (int i = 0; i < count; ++i) {
+        v.push_back(first + i);
+    }
+    return v;
+}
+
+} // namespace
+
+void test_persistent_vector_push_back_and_index() {
+    std::cout << "Running test_persistent_vector_push_back_and_index... ";
+    persistent_vector<int> v;
+    assert(v.empty() && v.begin() == v.end());
+    for (int i = 0; i < 40000; ++i) {
+        v = v.push_back(i);
+    }
+    assert(v.size() == 40000 && v.front() == 0 && v.back() == 39999);
+    for (int i = 0; i < 40000; i += 7) {
+        assert(v[i] == i);
+    }
+    assert(v.depth() == 4);
+
+    bool thrown = false;
+    try {
+        v.at(40000);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Passed!\n";
+}
+
+void test_persistent_vector_set_keeps_versions() {
+    std::cout << "Running test_persistent_vector_set_keeps_versions... ";
+    persistent_vector<std::string> v0{"a", "b", "c"};
+    persistent_vector<std::string> v1 = v0.set(1, "B");
+    persistent_vector<std::string> v2 = v1.push_back("d");
+    assert(v0[1] == "b" && v0.size() == 3);
+    assert(v1[1] == "B" && v1.size() == 3);
+    assert(v2[1] == "B" && v2[3] == "d");
+
+    persistent_vector<int> big(iota_vector(0, 5000));
+    persistent_vector<int> changed = big.set(1234, -1).set(4999, -2);
+    assert(big[1234] == 1234 && big[4999] == 4999);
+    assert(changed[1234] == -1 && changed[4999] == -2 && changed[1233] == 1233);
+    assert(big.pop_back().size() == 4999 && big.pop_back().back() == 4998);
+    std::cout << "Passed!\n";
+}
+
+void test_persistent_vector_bulk_conversion() {
+    std::cout << "Running test_persistent_vector_bulk_conversion... ";
+    for (int n : {0, 1, 32, 33, 1024, 1056, 100000}) {
+        my_vector<int> values = iota_vector(0, n);
+        persistent_vector<int> v(values);
+        assert(v.size() == static_cast<std::size_t>(n));
+        assert(v.to_vector() == values);
+        assert(std::equal(v.begin(), v.end(), values.begin(), values.end()));
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_persistent_vector_slice() {
+    std::cout << "Running test_persistent_vector_slice... ";
+    my_vector<int> values = iota_vector(0, 50000);
+    persistent_vector<int> v(values);
+    for (auto [first, last] : {std::pair<std::size_t, std::size_t>{0, 50000}, {1, 49999}, {31, 33},
+                               {1000, 1000}, {1023, 34000}, {49990, 50000}, {0, 17}}) {
+        persistent_vector<int> s = v.slice(first, last);
+        assert(s.size() == last - first);
+        assert(s.to_vector() == my_vector<int>(values.begin() + first, values.begin() + last));
+    }
+    assert(v.take(40000).drop(39000).push_back(-1).back() == -1);
+    std::cout << "Passed!\n";
+}
+
+void test_persistent_vector_concat() {
+    std::cout << "Running test_persistent_vector_concat... ";
+    persistent_vector<int> a(iota_vector(0, 3000));
+    persistent_vector<int> b(iota_vector(3000, 70000));
+    persistent_vector<int> ab = a.concat(b);
+    assert(ab.to_vector() == iota_vector(0, 73000));
+    assert(a.size() == 3000 && b.size() == 70000);
+
+    // Concatenating many odd-sized pieces keeps the tree shallow.
+    persistent_vector<int> all;
+    int next = 0;
+    for (int i = 0; i < 300; ++i) {
+        int count = 1 + (i * 37) % 113;
+        all = all.concat(persistent_vector<int>(iota_vector(next, count)));
+        next += count;
+    }
+    assert(all.to_vector() == iota_vector(0, next));
+    assert(all.depth() <= 4);
+    assert(all.set(100, -1)[100] == -1 && all.push_back(-2).back() == -2);
+    std::cout << "Passed!\n";
+}
+
+void test_persistent_vector_random_operations() {
+    std::cout << "Running test_persistent_vector_random_operations... ";
+    std::mt19937 rng(5);
+    persistent_vector<int> v(iota_vector(0, 2000));
+    my_vector<int> expected = iota_vector(0, 2000);
+    for (int round = 0; round < 300; ++round) {
+        switch (rng() % 4) {
+            case 0: {
+                std::size_t first = rng() % (expected.size() + 1);
+                std::size_t last = first + rng() % (expected.size() - first + 1);
+                v = v.slice(first, last);
+                expected = my_vector<int>(expected.begin() + first, expected.begin() + last);
+                break;
+            }
+            case 1: {
+                persistent_vector<int> other = v.drop(rng() % (v.size() + 1));
+                my_vector<int> tail(expected.end() - other.size(), expected.end());
+                v = v.concat(other);
+                expected.insert(expected.end(), tail.begin(), tail.end());
+                break;
+            }
+            case 2:
+                if (!expected.empty()) {
+                    std::size_t pos = rng() % expected.size();
+                    v = v.set(pos, round);
+                    expected[pos] = round;
+                }
+                break;
+            default:
+                for (int i = 0; i < 50; ++i) {
+                    v = v.push_back(i);
+                    expected.push_back(i);
+                }
+        }
+        if (expected.size() > 20000) {
+            v = v.take(5000);
+            expected.resize(5000);
+        }
+        assert(v.size() == expected.size());
+        for (std::size_t i = 0; i < expected.size(); i += 13) {
+            assert(v[i] == expected[i]);
+        }
+    }
+    assert(v.to_vector() == expected);
+    std::cout << "Passed!\n";
+}
+
+void test_persistent_vector_transient() {
+    std::cout << "Running test_persistent_vector_transient... ";
+    persistent_vector<int> base(iota_vector(0, 1000));
+    transient_vector<int> t = base.transient();
+    for (int i = 0; i < 5000; ++i) {
+        t.push_back(1000 + i);
+    }
+    t.set(10, -10);
+    persistent_vector<int> first = t.persistent();
+    // Edits after persistent() must not leak into the returned version.
+    t.set(10, -20);
+    t.push_back(-1);
+    persistent_vector<int> second = t.persistent();
+
+    assert(base.size() == 1000 && base[10] == 10);
+    assert(first.size() == 6000 && first[10] == -10 && first[5999] == 5999);
+    assert(second.size() == 6001 && second[10] == -20 && second.back() == -1);
+    std::cout << "Passed!\n";
+}
+
+void test_persistent_vector_transient_ownership() {
+    std::cout << "Running test_persistent_vector_transient_ownership... ";
+    static_assert(!std::is_copy_constructible_v<transient_vector<int>>);
+    static_assert(!std::is_copy_assignable_v<transient_vector<int>>);
+
+    transient_vector<int> t(persistent_vector<int>(iota_vector(0, 100)));
+    t.set(5, -5);
+    transient_vector<int> moved = std::move(t);
+    assert(t.empty() && moved.size() == 100 && moved[5] == -5);
+    // The moved-from transient starts over without reaching moved's nodes.
+    t.push_back(7);
+    moved.set(0, -1);
+    assert(t.size() == 1 && t[0] == 7 && moved[0] == -1);
+
+    // Transients made from the same version each copy the nodes they edit.
+    persistent_vector<int> shared = moved.persistent();
+    transient_vector<int> a = shared.transient();
+    transient_vector<int> b = shared.transient();
+    a.set(50, 1);
+    b.set(50, 2);
+    moved.set(50, 3);
+    assert(a[50] == 1 && b[50] == 2 && moved[50] == 3 && shared[50] == 50);
+    std::cout << "Passed!\n";
+}
+
+void run_all_persistent_vector_tests() {
+    std::cout << "Starting all persistent_vector tests...\n\n";
+
+    test_persistent_vector_push_back_and_index();
+    test_persistent_vector_set_keeps_versions();
+    test_persistent_vector_bulk_conversion();
+    test_persistent_vector_slice();
+    test_persistent_vector_concat();
+    test_persistent_vector_random_operations();
+    test_persistent_vector_transient();
+    test_persistent_vector_transient_ownership();
+
+    std::cout << "\n\033[3;42;30m  All persistent_vector tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,99 @@
+#include "testing_radix_sort.hpp"
+#include <cstdint>
+#include <random>
+
+
+void test_radix_sort_unsigned() {
+    std::cout << "Running test_radix_sort_unsigned... ";
+    std::mt19937_64 rng(1);
+    for (std::size_t n : {0, 1, 100, 100000}) {
+        my_vector<std::uint32_t> v;
+        for (std::size_t i = 0; i < n; ++i) {
+            v.push_back(static_cast<std::uint32_t>(rng()));
+        }
+        my_vector<std::uint32_t> expected(v);
+        std::sort(expected.begin(), expected.end());
+        radix_sort(v);
+        assert(v == expected);
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_radix_sort_signed() {
+    std::cout << "Running test_radix_sort_signed... ";
+    std::mt19937_64 rng(2);
+    my_vector<std::int64_t> v;
+    for (int i = 0; i < 50000; ++i) {
+        v.push_back(static_cast<std::int64_t>(rng() % 2001) - 1000);
+    }
+    v.push_back(INT64_MIN);
+    v.push_back(INT64_MAX);
+    my_vector<std::int64_t> expected(v);
+    std::sort(expected.begin(), expected.end());
+    radix_sort(v);
+    assert(v == expected);
+    std::cout << "Passed!\n";
+}
+
+void test_radix_sort_floating_point() {
+    std::cout << "Running test_radix_sort_floating_point... ";
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(-1e6f, 1e6f);
+    my_vector<float> v;
+    for (int i = 0; i < 50000; ++i) {
+        v.push_back(dist(rng));
+    }
+    v.push_back(0.0f);
+    v.push_back(-1e-30f);
+    my_vector<float> expected(v);
+    std::sort(expected.begin(), expected.end());
+    radix_sort(v);
+    assert(v == expected);
+    std::cout << "Passed!\n";
+}
+
+void test_radix_sort_key_extractor() {
+    std::cout << "Running test_radix_sort_key_extractor... ";
+    struct record {
+        std::uint16_t key;
+        std::uint32_t order;
+    };
+    my_vector<record> v;
+    for (std::uint32_t i = 0; i < 60000; ++i) {
+        v.push_back({static_cast<std::uint16_t>((i * 7919) % 500), i});
+    }
+    radix_sort(v, [](const record& r) { return r.key; });
+    for (std::size_t i = 1; i < v.size(); ++i) {
+        assert(v[i - 1].key <= v[i].key);
+        // Stable: equal keys keep their original order.
+        assert(v[i - 1].key != v[i].key || v[i - 1].order < v[i].order);
+    }
+    std::cout << "Passed!\n";
+}
+
+void test_radix_sort_spare_capacity() {
+    std::cout << "Running test_radix_sort_spare_capacity... ";
+    my_vector<std::uint64_t> v;
+    v.reserve(200000);
+    for (std::uint64_t i = 0; i < 100000; ++i) {
+        v.push_back((i * 0x9e3779b97f4a7c15ULL) >> 8);
+    }
+    const std::uint64_t* storage = v.data();
+    radix_sort(v);
+    assert(v.data() == storage);
+    assert(v.capacity() == 200000);
+    assert(std::is_sorted(v.begin(), v.end()));
+    std::cout << "Passed!\n";
+}
+
+void run_all_radix_sort_tests() {
+    std::cout << "Starting all radix sort tests...\n\n";
+
+    test_radix_sort_unsigned();
+    test_radix_sort_signed();
+    test_radix_sort_floating_point();
+    test_radix_sort_key_extractor();
+    test_radix_sort_spare_capacity();
+
+    std::cout << "\n\033[3;42;30m  All radix sort tests passed successfully!  \033[0m" << std::endl;
+}
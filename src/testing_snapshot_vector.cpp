@@ -0,0 +1,133 @@
+#include "testing_snapshot_vector.hpp"
+#include <thread>
+
+
+void test_snapshot_vector_publish_and_read() {
+    std::cout << "Running test_snapshot_vector_publish_and_read... ";
+    snapshot_vector<int> v({1, 2, 3});
+    {
+        auto s = v.read();
+        assert(s.size() == 3 && s[1] == 2);
+        v.publish({4, 5});
+        // The snapshot keeps the version it was taken from.
+        assert(*s == my_vector<int>({1, 2, 3}));
+        auto nested = v.read();
+        assert(*nested == my_vector<int>({4, 5}));
+    }
+    assert(v.copy() == my_vector<int>({4, 5}));
+    assert(v.version() == 1);
+    std::cout << "Passed!\n";
+}
+
+void test_snapshot_vector_update() {
+    std::cout << "Running test_snapshot_vector_update... ";
+    snapshot_vector<int> v;
+    assert(v.read().empty());
+    for (int i = 0; i < 10; ++i) {
+        v.update([i](my_vector<int>& data) { data.push_back(i); });
+    }
+    assert(v.read().size() == 10 && v.read()[9] == 9);
+
+    bool thrown = false;
+    try {
+        v.update([](my_vector<int>& data) {
+            data.clear();
+            throw std::runtime_error("abandoned");
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && v.read().size() == 10 && v.version() == 10);
+    std::cout << "Passed!\n";
+}
+
+namespace {
+
+struct counted {
+    static std::atomic<int> live;
+    int value;
+
+    counted(int v = 0) : value(v) { ++live; }
+    counted(const counted& other) : value(other.value) { ++live; }
+    counted(counted&& other) noexcept : value(other.value) { ++live; }
+    counted& operator=(const counted&) = default;
+    ~counted() { --live; }
+};
+
+std::atomic<int> counted::live{0};
+
+} // namespace
+
+void test_snapshot_vector_deferred_reclamation() {
+    std::cout << "Running test_snapshot_vector_deferred_reclamation... ";
+    epoch_domain& domain = epoch_domain::global();
+    domain.reclaim();
+    {
+        snapshot_vector<counted> v(my_vector<counted>(3, counted(1)));
+        assert(counted::live == 3);
+        {
+            auto s = v.read();
+            v.publish(my_vector<counted>(2, counted(2)));
+            // The old version is still visible through s.
+            assert(counted::live == 5 && domain.pending() == 1);
+            assert(s[0].value == 1);
+        }
+        domain.reclaim();
+        assert(counted::live == 2 && domain.pending() == 0);
+
+        // Without readers a publish frees the previous version right away.
+        v.publish(my_vector<counted>(4, counted(3)));
+        assert(counted::live == 4);
+    }
+    assert(counted::live == 0);
+    std::cout << "Passed!\n";
+}
+
+void test_snapshot_vector_concurrent_readers() {
+    std::cout << "Running test_snapshot_vector_concurrent_readers... ";
+    // Every version holds its version number in all elements, so a torn or
+    // freed version is detected by the readers.
+    snapshot_vector<std::uint64_t> v(my_vector<std::uint64_t>(64, 0));
+    std::atomic<bool> stop{false};
+    std::atomic<bool> consistent{true};
+
+    my_vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.push_back(std::thread([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                auto s = v.read();
+                std::uint64_t first = s[0];
+                for (std::uint64_t value : s) {
+                    if (value != first) {
+                        consistent.store(false);
+                    }
+                }
+            }
+        }));
+    }
+
+    for (std::uint64_t version = 1; version <= 2000; ++version) {
+        v.publish(my_vector<std::uint64_t>(64, version));
+    }
+    stop.store(true);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    epoch_domain::global().reclaim();
+
+    assert(consistent.load());
+    assert(v.read()[0] == 2000);
+    assert(epoch_domain::global().pending() == 0);
+    std::cout << "Passed!\n";
+}
+
+void run_all_snapshot_vector_tests() {
+    std::cout << "Starting all snapshot_vector tests...\n\n";
+
+    test_snapshot_vector_publish_and_read();
+    test_snapshot_vector_update();
+    test_snapshot_vector_deferred_reclamation();
+    test_snapshot_vector_concurrent_readers();
+
+    std::cout << "\n\033[3;42;30m  All snapshot_vector tests passed successfully!  \033[0m" << std::endl;
+}
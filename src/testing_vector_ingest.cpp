@@ -0,0 +1,216 @@
+#include "testing_vector_ingest.hpp"
+#include <cstdint>
+#include <ios>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+
+void test_input_iterator_constructor() {
+    std::cout << "Running test_input_iterator_constructor... ";
+    std::istringstream in("1 2 3 4 5");
+    my_vector<int> v{std::istream_iterator<int>(in), std::istream_iterator<int>()};
+    assert(v == my_vector<int>({1, 2, 3, 4, 5}));
+    std::cout << "Passed!\n";
+}
+
+void test_input_iterator_insert() {
+    std::cout << "Running test_input_iterator_insert... ";
+    std::istringstream in("2 3 4");
+    my_vector<int> v = {1, 5};
+    auto it = v.insert(v.begin() + 1, std::istream_iterator<int>(in), std::istream_iterator<int>());
+    assert(it == v.begin() + 1);
+    assert(v == my_vector<int>({1, 2, 3, 4, 5}));
+    std::cout << "Passed!\n";
+}
+
+namespace {
+
+// Single-pass source that fails after a few elements.
+struct failing_input {
+    using iterator_category = std::input_iterator_tag;
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const int*;
+    using reference = int;
+
+    int value = 0;
+
+    int operator*() const {
+        if (value == 3) throw std::runtime_error("source failed");
+        return value;
+    }
+
+    failing_input& operator++() {
+        ++value;
+        return *this;
+    }
+
+    bool operator==(const failing_input& other) const = default;
+};
+
+} // namespace
+
+void test_input_iterator_insert_rollback() {
+    std::cout << "Running test_input_iterator_insert_rollback... ";
+    my_vector<int> v = {7, 8, 9};
+    bool thrown = false;
+    try {
+        v.insert(v.begin() + 1, failing_input{0}, failing_input{10});
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(v == my_vector<int>({7, 8, 9}));
+    std::cout << "Passed!\n";
+}
+
+void test_read_binary_stream() {
+    std::cout << "Running test_read_binary_stream... ";
+    my_vector<std::uint32_t> source;
+    for (std::uint32_t i = 0; i < 10000; ++i) {
+        source.push_back(i * 7);
+    }
+    std::string bytes(reinterpret_cast<const char*>(source.data()), source.size() * sizeof(std::uint32_t));
+    std::istringstream in(bytes);
+
+    my_vector<std::uint32_t> loaded = {42};
+    std::size_t calls = 0;
+    std::size_t last_bytes = 0;
+    std::size_t count = read_binary(in, loaded, [&](const ingest_progress& p) {
+        ++calls;
+        last_bytes = p.bytes;
+    }, 4096);
+    assert(count == source.size());
+    assert(loaded.size() == source.size() + 1);
+    assert(loaded[0] == 42);
+    assert(std::equal(source.begin(), source.end(), loaded.begin() + 1));
+    assert(calls >= 10);
+    assert(last_bytes == bytes.size());
+    std::cout << "Passed!\n";
+}
+
+void test_read_binary_truncated() {
+    std::cout << "Running test_read_binary_truncated... ";
+    std::istringstream in(std::string(10, 'x'));
+    my_vector<std::uint32_t> loaded;
+    bool thrown = false;
+    try {
+        read_binary(in, loaded);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(loaded.size() == 2);
+    std::cout << "Passed!\n";
+}
+
+namespace {
+
+// Stream buffer that hands out its data and then fails, like a device that
+// reports an I/O error.
+class failing_buffer : public std::streambuf {
+    std::string data_;
+    bool served_ = false;
+
+protected:
+    int_type underflow() override {
+        if (served_) throw std::runtime_error("device error");
+        served_ = true;
+        setg(data_.data(), data_.data(), data_.data() + data_.size());
+        return traits_type::to_int_type(data_[0]);
+    }
+
+public:
+    explicit failing_buffer(std::string data) : data_(std::move(data)) {}
+};
+
+} // namespace
+
+void test_read_binary_stream_error() {
+    std::cout << "Running test_read_binary_stream_error... ";
+    failing_buffer binary(std::string(8, 'x'));
+    std::istream binary_in(&binary);
+    my_vector<std::uint32_t> loaded;
+    bool thrown = false;
+    try {
+        read_binary(binary_in, loaded);
+    } catch (const std::ios_base::failure&) {
+        thrown = true;
+    }
+    // A failed read is not mistaken for the end of the data.
+    assert(thrown && loaded.size() <= 2);
+
+    failing_buffer text("1 2 3 ");
+    std::istream text_in(&text);
+    my_vector<int> parsed;
+    thrown = false;
+    try {
+        read_text(text_in, parsed);
+    } catch (const std::ios_base::failure&) {
+        thrown = true;
+    }
+    assert(thrown && parsed.size() == 3);
+    std::cout << "Passed!\n";
+}
+
+void test_read_binary_fd() {
+    std::cout << "Running test_read_binary_fd... ";
+#if defined(__unix__) || defined(__APPLE__)
+    int fds[2];
+    int piped = pipe(fds);
+    assert(piped == 0);
+    // Odd-sized writes force short reads that split elements.
+    std::uint64_t values[] = {1, 2, 3, 0xffffffffffffffffULL};
+    const char* raw = reinterpret_cast<const char*>(values);
+    std::size_t written = 0;
+    while (written < sizeof(values)) {
+        std::size_t part = std::min<std::size_t>(5, sizeof(values) - written);
+        ssize_t wrote = write(fds[1], raw + written, part);
+        assert(wrote == static_cast<ssize_t>(part));
+        written += part;
+    }
+    close(fds[1]);
+
+    my_vector<std::uint64_t> loaded;
+    std::size_t count = read_binary(fds[0], loaded);
+    assert(count == 4);
+    close(fds[0]);
+    assert(loaded == my_vector<std::uint64_t>({1, 2, 3, 0xffffffffffffffffULL}));
+#endif
+    std::cout << "Passed!\n";
+}
+
+void test_read_text() {
+    std::cout << "Running test_read_text... ";
+    std::istringstream in("3.5 -1 2e3\n7");
+    my_vector<double> loaded;
+    std::size_t reports = 0;
+    std::size_t count = read_text(in, loaded, [&](const ingest_progress&) { ++reports; }, 2);
+    assert(count == 4);
+    assert(loaded == my_vector<double>({3.5, -1, 2000, 7}));
+    assert(reports == 3);
+    std::cout << "Passed!\n";
+}
+
+void run_all_vector_ingest_tests() {
+    std::cout << "Starting all vector ingest tests...\n\n";
+
+    test_input_iterator_constructor();
+    test_input_iterator_insert();
+    test_input_iterator_insert_rollback();
+    test_read_binary_stream();
+    test_read_binary_truncated();
+    test_read_binary_stream_error();
+    test_read_binary_fd();
+    test_read_text();
+
+    std::cout << "\n\033[3;42;30m  All vector ingest tests passed successfully!  \033[0m" << std::endl;
+}
@@ -0,0 +1,118 @@
+#include "trim_registry.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+trim_registry& trim_registry::global() {
+    static trim_registry registry;
+    return registry;
+}
+
+void trim_registry::enroll(trimmable* member) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    members_.push_back(member);
+}
+
+void trim_registry::withdraw(trimmable* member) noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find(members_.begin(), members_.end(), member);
+    if (it != members_.end()) {
+        *it = members_.back();
+        members_.pop_back();
+    }
+}
+
+void trim_registry::replace(trimmable* from, trimmable* to) noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find(members_.begin(), members_.end(), from);
+    if (it != members_.end()) {
+        *it = to;
+    }
+}
+
+std::size_t trim_registry::trim_all() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t released = 0;
+    for (trimmable* member : members_) {
+        released += member->trim();
+    }
+    return released;
+}
+
+std::size_t trim_registry::enrolled() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return members_.size();
+}
+
+memory_pressure_watcher::memory_pressure_watcher(std::uint32_t stall_us, std::uint32_t window_us)
+        : stall_us_(stall_us), window_us_(window_us) {}
+
+memory_pressure_watcher::~memory_pressure_watcher() {
+    stop();
+}
+
+bool memory_pressure_watcher::start() {
+    // cgroup v2 lists the process' cgroup as "0::/path".
+    std::ifstream cgroup("/proc/self/cgroup");
+    std::string line;
+    while (std::getline(cgroup, line)) {
+        if (line.rfind("0::", 0) == 0) {
+            if (start("/sys/fs/cgroup" + line.substr(3) + "/memory.pressure")) return true;
+            break;
+        }
+    }
+    return start("/proc/pressure/memory");
+}
+
+bool memory_pressure_watcher::start(const std::string& pressure_file) {
+#if defined(__linux__)
+    if (running()) return true;
+
+    fd_ = open(pressure_file.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd_ < 0) return false;
+
+    std::string trigger = "some " + std::to_string(stall_us_) + " " + std::to_string(window_us_);
+    if (write(fd_, trigger.c_str(), trigger.size() + 1) < 0) {
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    stopping_.store(false);
+    thread_ = std::thread([this] {
+        pollfd watched{fd_, POLLPRI, 0};
+        while (!stopping_.load(std::memory_order_relaxed)) {
+            // Wake up periodically to notice stop().
+            int ready = poll(&watched, 1, 100);
+            if (ready > 0 && (watched.revents & POLLERR)) break;
+            if (ready > 0 && (watched.revents & POLLPRI)) {
+                events_.fetch_add(1, std::memory_order_relaxed);
+                trim_registry::global().trim_all();
+            }
+        }
+    });
+    return true;
+#else
+    static_cast<void>(pressure_file);
+    return false;
+#endif
+}
+
+void memory_pressure_watcher::stop() {
+    if (thread_.joinable()) {
+        stopping_.store(true);
+        thread_.join();
+    }
+#if defined(__linux__)
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+#endif
+}
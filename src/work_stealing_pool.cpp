@@ -0,0 +1,109 @@
+#include "work_stealing_pool.hpp"
+
+namespace {
+
+// Pool and queue index the current thread works for, if any.
+thread_local const work_stealing_pool* current_pool = nullptr;
+thread_local std::size_t current_index = 0;
+
+} // namespace
+
+work_stealing_pool::work_stealing_pool(unsigned threads) {
+    unsigned worker_count = threads > 1 ? threads - 1 : 0;
+    queue_count_ = worker_count + 1;
+    queues_ = std::make_unique<task_queue[]>(queue_count_);
+
+    workers_.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back([this, i] { worker_loop(i); });
+    }
+}
+
+work_stealing_pool::~work_stealing_pool() {
+    while (run_one()) {
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+work_stealing_pool& work_stealing_pool::global() {
+    static work_stealing_pool pool;
+    return pool;
+}
+
+std::size_t work_stealing_pool::local_queue() const noexcept {
+    return current_pool == this ? current_index : queue_count_ - 1;
+}
+
+void work_stealing_pool::push(job* task) {
+    // Count the task before publishing it so pending_ never underflows.
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+    task_queue& queue = queues_[local_queue()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(task);
+    }
+    wake_.notify_one();
+}
+
+work_stealing_pool::job* work_stealing_pool::pop_local() {
+    task_queue& queue = queues_[local_queue()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) return nullptr;
+    job* task = queue.jobs.back();
+    queue.jobs.pop_back();
+    return task;
+}
+
+work_stealing_pool::job* work_stealing_pool::steal() {
+    std::size_t start = local_queue() + 1;
+    for (std::size_t i = 0; i < queue_count_; ++i) {
+        task_queue& queue = queues_[(start + i) % queue_count_];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job* task = queue.jobs.front();
+            queue.jobs.pop_front();
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+bool work_stealing_pool::run_one() {
+    job* task = pop_local();
+    if (task == nullptr) {
+        task = steal();
+    }
+    if (task == nullptr) return false;
+
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    task->execute(task);
+    return true;
+}
+
+void work_stealing_pool::wait_for(const job& task) {
+    run_until([&task] { return task.done.load(std::memory_order_acquire); });
+}
+
+void work_stealing_pool::worker_loop(std::size_t index) {
+    current_pool = this;
+    current_index = index;
+
+    while (true) {
+        if (run_one()) continue;
+
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this] { return stopping_ || pending_.load(std::memory_order_relaxed) > 0; });
+        // Leave only once the posted tasks are done.
+        if (stopping_ && pending_.load(std::memory_order_relaxed) == 0) return;
+    }
+}